@@ -0,0 +1,235 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "AsyncWriter.hpp"
+#include "NativeModule.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#ifdef _WIN32
+#include <process.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace rapidnbt {
+
+namespace {
+
+bool syncFile(std::filesystem::path const& path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) { return false; }
+    bool result = FlushFileBuffers(file);
+    CloseHandle(file);
+    return result;
+#else
+    int file = ::open(path.c_str(), O_WRONLY);
+    if (file < 0) { return false; }
+    bool result = ::fsync(file) == 0;
+    ::close(file);
+    return result;
+#endif
+}
+
+bool replaceFile(std::filesystem::path const& from, std::filesystem::path const& to) {
+#ifdef _WIN32
+    return MoveFileExW(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    if (::rename(from.c_str(), to.c_str()) != 0) { return false; }
+    // Persist the directory entry as well, otherwise the rename itself can be lost
+    auto directory = to.parent_path();
+    int  file      = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (file >= 0) {
+        ::fsync(file);
+        ::close(file);
+    }
+    return true;
+#endif
+}
+
+std::filesystem::path temporaryPath(std::filesystem::path const& path) {
+    static std::atomic<uint64_t> counter{0};
+#ifdef _WIN32
+    auto process = _getpid();
+#else
+    auto process = ::getpid();
+#endif
+    auto result = path;
+    result += std::format(".{}.{}.tmp", process, counter.fetch_add(1, std::memory_order_relaxed));
+    return result;
+}
+
+struct WriteJob {
+    std::filesystem::path    mPath;
+    FileWriter               mWriter;
+    std::promise<bool>       mPromise;
+    std::shared_future<bool> mResult;
+};
+
+// Single worker thread, so writes of one path always land in submission order
+class BackgroundWriter {
+public:
+    static BackgroundWriter& instance() {
+        static BackgroundWriter writer;
+        return writer;
+    }
+
+    ~BackgroundWriter() {
+        {
+            std::lock_guard lock(mMutex);
+            mStopping = true;
+        }
+        mWakeUp.notify_all();
+    }
+
+    WriteHandle submit(std::filesystem::path const& path, FileWriter writer) {
+        std::error_code ec;
+        auto            key = std::filesystem::absolute(path, ec).lexically_normal();
+        if (ec) { key = path.lexically_normal(); }
+        std::lock_guard lock(mMutex);
+        if (auto pending = mPending.find(key.string()); pending != mPending.end()) {
+            pending->second->mWriter = std::move(writer);
+            return WriteHandle(path, pending->second->mResult);
+        }
+        auto job     = std::make_shared<WriteJob>();
+        job->mPath   = key;
+        job->mWriter = std::move(writer);
+        job->mResult = job->mPromise.get_future().share();
+        mPending.emplace(key.string(), job);
+        mQueue.push_back(job);
+        if (!mThread.joinable()) { mThread = std::jthread([this] { run(); }); }
+        mWakeUp.notify_one();
+        return WriteHandle(path, job->mResult);
+    }
+
+    void wait() {
+        std::unique_lock lock(mMutex);
+        mIdle.wait(lock, [this] { return mQueue.empty() && !mBusy; });
+    }
+
+private:
+    BackgroundWriter() = default;
+
+    void run() {
+        std::unique_lock lock(mMutex);
+        while (true) {
+            mWakeUp.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+            // Queued writes are still finished when the module is unloaded
+            if (mQueue.empty()) { return; }
+            auto job = std::move(mQueue.front());
+            mQueue.pop_front();
+            mPending.erase(job->mPath.string());
+            mBusy = true;
+            lock.unlock();
+            bool result = false;
+            try {
+                result = writeFileAtomic(job->mPath, job->mWriter);
+            } catch (...) {
+                result = false;
+            }
+            job->mPromise.set_value(result);
+            job.reset();
+            lock.lock();
+            mBusy = false;
+            if (mQueue.empty()) { mIdle.notify_all(); }
+        }
+    }
+
+    std::mutex                                                  mMutex;
+    std::condition_variable                                     mWakeUp;
+    std::condition_variable                                     mIdle;
+    std::deque<std::shared_ptr<WriteJob>>                       mQueue;
+    std::unordered_map<std::string, std::shared_ptr<WriteJob>> mPending;
+    bool                                                        mBusy{false};
+    bool                                                        mStopping{false};
+    std::jthread                                                mThread;
+};
+
+} // namespace
+
+bool writeFileAtomic(std::filesystem::path const& path, FileWriter const& writer) {
+    auto            temp = temporaryPath(path);
+    std::error_code ec;
+    if (!writer(temp) || !syncFile(temp) || !replaceFile(temp, path)) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+bool writeContent(std::filesystem::path const& path, std::string_view content) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    file.close();
+    return !file.fail();
+}
+
+WriteHandle WriteHandle::completed(std::filesystem::path path, bool result) {
+    std::promise<bool> promise;
+    promise.set_value(result);
+    return WriteHandle(std::move(path), promise.get_future().share());
+}
+
+bool WriteHandle::done() const { return mResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+bool WriteHandle::wait(std::optional<double> timeout) const {
+    if (!timeout) {
+        mResult.wait();
+        return true;
+    }
+    return mResult.wait_for(std::chrono::duration<double>(*timeout)) == std::future_status::ready;
+}
+
+bool WriteHandle::result() const { return mResult.get(); }
+
+WriteHandle submitWrite(std::filesystem::path const& path, FileWriter writer) { return BackgroundWriter::instance().submit(path, std::move(writer)); }
+
+void waitForWrites() { BackgroundWriter::instance().wait(); }
+
+void bindAsyncWriter(py::module& m) {
+    auto sm = m.def_submodule("write_handle", "Result of a background write");
+
+    py::class_<WriteHandle>(sm, "WriteHandle")
+        .def_property_readonly("path", &WriteHandle::path, "Path of the file being written")
+        .def("done", &WriteHandle::done, "Check if the write has finished")
+        .def(
+            "wait",
+            &WriteHandle::wait,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("timeout") = std::nullopt,
+            "Wait for the write to finish\nArgs:\n    timeout (Optional[float]): Maximum seconds to wait (default: None, no limit)\nReturns:\n    True if "
+            "the write has finished"
+        )
+        .def(
+            "result",
+            &WriteHandle::result,
+            py::call_guard<py::gil_scoped_release>(),
+            "Wait for the write to finish and get its result\nReturns:\n    True if the file was written and renamed into place"
+        )
+        .def(
+            "__repr__",
+            [](WriteHandle const& self) {
+                return std::format("<rapidnbt.WriteHandle(path={0}, done={1}) object at 0x{2:0{3}X}>", self.path().string(), self.done(), ADDRESS);
+            },
+            "Official string representation"
+        );
+
+    // Finish queued writes before the interpreter shuts down
+    py::module::import("atexit").attr("register")(py::cpp_function([] {
+        py::gil_scoped_release release;
+        waitForWrites();
+    }));
+}
+
+} // namespace rapidnbt
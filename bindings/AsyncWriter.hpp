@@ -0,0 +1,54 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <optional>
+#include <string_view>
+
+namespace rapidnbt {
+
+// Writes the content of a file to the path it is given, false on failure
+using FileWriter = std::function<bool(std::filesystem::path const&)>;
+
+// Write to a temporary file next to path, flush it to disk and rename it over path, so that a crash at any point leaves
+// either the old or the new file
+bool writeFileAtomic(std::filesystem::path const& path, FileWriter const& writer);
+
+// Write content to path, false if opening, writing or closing the file failed
+bool writeContent(std::filesystem::path const& path, std::string_view content);
+
+// Result of a background write, shared by every save of the same path that was coalesced into it
+class WriteHandle {
+public:
+    WriteHandle(std::filesystem::path path, std::shared_future<bool> result) : mPath(std::move(path)), mResult(std::move(result)) {}
+
+    // Handle of a write that was not needed, e.g. saving an unmodified file
+    static WriteHandle completed(std::filesystem::path path, bool result);
+
+    std::filesystem::path const& path() const noexcept { return mPath; }
+
+    bool done() const;
+    // True if the write finished within timeout seconds (no timeout: wait until it finishes)
+    bool wait(std::optional<double> timeout) const;
+    bool result() const;
+
+private:
+    std::filesystem::path    mPath;
+    std::shared_future<bool> mResult;
+};
+
+// Queue writeFileAtomic(path, writer) on the background writer thread
+// A queued write of the same path that has not started yet is replaced, and its handle completes with this one
+WriteHandle submitWrite(std::filesystem::path const& path, FileWriter writer);
+
+// Block until every queued write has finished
+void waitForWrites();
+
+} // namespace rapidnbt
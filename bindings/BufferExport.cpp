@@ -0,0 +1,63 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "BufferExport.hpp"
+#include <unordered_map>
+
+namespace rapidnbt {
+
+namespace {
+
+// Live exports per tag, only touched with the GIL held
+std::unordered_map<nbt::Tag const*, std::size_t>& exportCounts() {
+    // Never destroyed, capsules may still be released while the interpreter finalizes
+    static auto* counts = new std::unordered_map<nbt::Tag const*, std::size_t>();
+    return *counts;
+}
+
+void releaseExport(void* tag) {
+    auto& counts = exportCounts();
+    auto  found  = counts.find(static_cast<nbt::Tag const*>(tag));
+    if (found != counts.end() && --found->second == 0) { counts.erase(found); }
+}
+
+} // namespace
+
+py::buffer_info exportBuffer(nbt::Tag const& tag, void* data, py::ssize_t itemSize, std::string const& format, py::ssize_t size) {
+    py::capsule token(&tag, &releaseExport);
+    ++exportCounts()[&tag];
+
+    // buffer_info copies the format and shape, and releases the view (dropping the token) when pybind11 frees it
+    auto* view     = new Py_buffer{};
+    view->buf      = data;
+    view->len      = size * itemSize;
+    view->itemsize = itemSize;
+    view->format   = const_cast<char*>(format.c_str());
+    view->ndim     = 1;
+    view->shape    = &size;
+    try {
+        py::buffer_info info(view);
+        view->format = nullptr;
+        view->shape  = nullptr;
+        view->obj    = token.release().ptr();
+        return info;
+    } catch (...) {
+        delete view;
+        throw;
+    }
+}
+
+bool hasExportedBuffer(nbt::Tag const& tag) {
+    auto const& counts = exportCounts();
+    return !counts.empty() && counts.contains(&tag);
+}
+
+void ensureResizable(nbt::Tag const& tag) {
+    if (hasExportedBuffer(tag)) { throw py::buffer_error("Existing exports of data: object cannot be re-sized"); }
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,31 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "NativeModule.hpp"
+#include <string>
+
+namespace rapidnbt {
+
+// Buffer for def_buffer of an array tag, counted as an export of tag until the consumer releases its view
+// The view owns a capsule that is freed together with it, so no buffer slots of the pybind11 class are replaced
+py::buffer_info exportBuffer(nbt::Tag const& tag, void* data, py::ssize_t itemSize, std::string const& format, py::ssize_t size);
+
+template <typename Storage>
+py::buffer_info exportBuffer(nbt::Tag const& tag, Storage& storage) {
+    using T = typename Storage::value_type;
+    return exportBuffer(tag, storage.data(), sizeof(T), py::format_descriptor<T>::format(), static_cast<py::ssize_t>(storage.size()));
+}
+
+// True while a buffer exported by tag is alive
+bool hasExportedBuffer(nbt::Tag const& tag);
+
+// Throw BufferError, as bytearray does, before changing the size of an array that has a live buffer export, since the view
+// would keep pointing at the old storage
+void ensureResizable(nbt::Tag const& tag);
+
+} // namespace rapidnbt
@@ -5,6 +5,7 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "BufferExport.hpp"
 #include "NativeModule.hpp"
 
 namespace rapidnbt {
@@ -12,7 +13,8 @@ namespace rapidnbt {
 void bindByteArrayTag(py::module& m) {
     auto sm = m.def_submodule("byte_array_tag", "A tag contains a byte array");
 
-    py::class_<nbt::ByteArrayTag, nbt::Tag>(sm, "ByteArrayTag")
+    py::class_<nbt::ByteArrayTag, nbt::Tag>(sm, "ByteArrayTag", py::buffer_protocol())
+        .def_buffer([](nbt::ByteArrayTag& self) { return exportBuffer(self, self.storage()); })
         .def(py::init<>(), "Construct an empty ByteArrayTag")
         .def(py::init<std::vector<uint8_t> const&>(), py::arg("arr"), "Construct from a list of bytes (e.g., [1, 2, 3])")
         .def(
@@ -34,7 +36,10 @@ void bindByteArrayTag(py::module& m) {
         )
         .def(
             "load",
-            [](nbt::ByteArrayTag& self, bstream::ReadOnlyBinaryStream& stream) { self.load(stream); },
+            [](nbt::ByteArrayTag& self, bstream::ReadOnlyBinaryStream& stream) {
+                ensureResizable(self);
+                self.load(stream);
+            },
             py::arg("stream"),
             "Load tag value from a binary stream"
         )
@@ -42,13 +47,16 @@ void bindByteArrayTag(py::module& m) {
         .def_property(
             "value",
             [](nbt::ByteArrayTag& self) -> py::bytes { return to_py_bytes(static_cast<std::string_view>(self)); },
-            [](nbt::ByteArrayTag& self, py::buffer value) { self = to_cpp_stringview(value); },
+            [](nbt::ByteArrayTag& self, py::buffer value) {
+                ensureResizable(self);
+                self = to_cpp_stringview(value);
+            },
             "Access the byte array as a list of integers (0-255)"
         )
         .def(
             "data",
-            [](nbt::ByteArrayTag& self) { return py::memoryview::from_memory(self.data(), self.size()); },
-            "Get a raw memory view of the byte data"
+            [](py::object self) { return py::memoryview(self); },
+            "Get a raw memory view of the byte data\nThe array can not be resized while the view is alive"
         )
 
         .def(
@@ -72,23 +80,47 @@ void bindByteArrayTag(py::module& m) {
         )
 
         .def("size", &nbt::ByteArrayTag::size, "Get number of bytes in the array")
-        .def("reserve", &nbt::ByteArrayTag::reserve, py::arg("size"), "Preallocate memory for future additions")
-        .def("clear", &nbt::ByteArrayTag::clear, "Clear all byte data")
+        .def(
+            "reserve",
+            [](nbt::ByteArrayTag& self, std::size_t size) {
+                ensureResizable(self);
+                self.reserve(size);
+            },
+            py::arg("size"),
+            "Preallocate memory for future additions"
+        )
+        .def(
+            "clear",
+            [](nbt::ByteArrayTag& self) {
+                ensureResizable(self);
+                self.clear();
+            },
+            "Clear all byte data"
+        )
         .def(
             "append",
-            [](nbt::ByteArrayTag& self, uint8_t value) { self.push_back(value); },
+            [](nbt::ByteArrayTag& self, uint8_t value) {
+                ensureResizable(self);
+                self.push_back(value);
+            },
             py::arg("value"),
             "Add a byte to the end of the array"
         )
         .def(
             "pop",
-            [](nbt::ByteArrayTag& self, size_t index) { return self.remove(index); },
+            [](nbt::ByteArrayTag& self, size_t index) {
+                ensureResizable(self);
+                return self.remove(index);
+            },
             py::arg("index"),
             "Remove byte at specified index"
         )
         .def(
             "pop",
-            [](nbt::ByteArrayTag& self, size_t start, size_t end) { return self.remove(start, end); },
+            [](nbt::ByteArrayTag& self, size_t start, size_t end) {
+                ensureResizable(self);
+                return self.remove(start, end);
+            },
             py::arg("start_index"),
             py::arg("end_index"),
             "Remove bytes in the range [start_index, end_index)"
@@ -96,6 +128,7 @@ void bindByteArrayTag(py::module& m) {
         .def(
             "assign",
             [](nbt::ByteArrayTag& self, py::buffer value) {
+                ensureResizable(self);
                 self = to_cpp_stringview(value);
                 return self;
             },
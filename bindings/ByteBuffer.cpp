@@ -0,0 +1,36 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "ByteBuffer.hpp"
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace rapidnbt {
+
+ByteBuffer::ByteBuffer(ByteBuffer&& other) noexcept : mData(std::exchange(other.mData, nullptr)), mSize(std::exchange(other.mSize, 0)) {}
+
+ByteBuffer& ByteBuffer::operator=(ByteBuffer&& other) noexcept {
+    if (this != &other) {
+        std::free(mData);
+        mData = std::exchange(other.mData, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+    }
+    return *this;
+}
+
+ByteBuffer::~ByteBuffer() { std::free(mData); }
+
+void ByteBuffer::resize(std::size_t size) {
+    // Keep one byte allocated so an empty buffer still has a valid data pointer
+    auto* data = static_cast<char*>(std::realloc(mData, size > 0 ? size : 1));
+    if (!data) { throw std::bad_alloc(); }
+    mData = data;
+    mSize = size;
+}
+
+} // namespace rapidnbt
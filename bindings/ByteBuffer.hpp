@@ -0,0 +1,36 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <cstddef>
+#include <string_view>
+
+namespace rapidnbt {
+
+// Growable byte buffer on the system heap, such as content inflated before parsing. Unlike std::string, bytes added by
+// resize() are left uninitialized, so growing an inflate buffer does not zero memory the decompressor overwrites anyway
+class ByteBuffer {
+public:
+    ByteBuffer() noexcept = default;
+    explicit ByteBuffer(std::size_t size) { resize(size); }
+    ByteBuffer(ByteBuffer&& other) noexcept;
+    ByteBuffer& operator=(ByteBuffer&& other) noexcept;
+    ~ByteBuffer();
+
+    char*            data() noexcept { return mData; }
+    const char*      data() const noexcept { return mData; }
+    std::size_t      size() const noexcept { return mSize; }
+    std::string_view view() const noexcept { return {mData, mSize}; }
+
+    void resize(std::size_t size);
+
+private:
+    char*       mData{nullptr};
+    std::size_t mSize{0};
+};
+
+} // namespace rapidnbt
@@ -0,0 +1,58 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "ByteSource.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <zlib.h>
+
+namespace rapidnbt {
+
+constexpr std::size_t INFLATE_INPUT_CHUNK = 1u << 16;
+
+std::size_t MemorySource::read(char* buffer, std::size_t size) {
+    auto count = std::min(size, mData.size());
+    std::memcpy(buffer, mData.data(), count);
+    mData.remove_prefix(count);
+    return count;
+}
+
+std::size_t FileSource::read(char* buffer, std::size_t size) {
+    mFile.read(buffer, static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(mFile.gcount());
+}
+
+InflateSource::InflateSource(std::unique_ptr<ByteSource> input) : mInput(std::move(input)), mStream(std::make_unique<z_stream_s>()) {
+    if (inflateInit2(mStream.get(), 15 + 32) != Z_OK) { throw std::runtime_error("failed to initialize zlib inflate stream"); }
+    mInputBuffer.resize(INFLATE_INPUT_CHUNK);
+}
+
+InflateSource::~InflateSource() { inflateEnd(mStream.get()); }
+
+std::size_t InflateSource::read(char* buffer, std::size_t size) {
+    if (mFinished) { return 0; }
+    mStream->next_out  = reinterpret_cast<Bytef*>(buffer);
+    mStream->avail_out = static_cast<uInt>(size);
+    while (mStream->avail_out > 0) {
+        if (mStream->avail_in == 0) {
+            auto count = mInput->read(mInputBuffer.data(), mInputBuffer.size());
+            if (count == 0) { throw std::runtime_error("unexpected end of compressed content"); }
+            mStream->next_in  = reinterpret_cast<Bytef*>(mInputBuffer.data());
+            mStream->avail_in = static_cast<uInt>(count);
+        }
+        auto status = inflate(mStream.get(), Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            mFinished = true;
+            break;
+        }
+        if (status != Z_OK) { throw std::runtime_error("corrupted compressed content"); }
+    }
+    return size - mStream->avail_out;
+}
+
+} // namespace rapidnbt
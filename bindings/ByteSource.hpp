@@ -0,0 +1,63 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+struct z_stream_s;
+
+namespace rapidnbt {
+
+// Sequential producer of bytes, read() returns 0 once the source is exhausted
+class ByteSource {
+public:
+    virtual ~ByteSource() = default;
+
+    virtual std::size_t read(char* buffer, std::size_t size) = 0;
+};
+
+class MemorySource : public ByteSource {
+public:
+    explicit MemorySource(std::string_view data) noexcept : mData(data) {}
+
+    std::size_t read(char* buffer, std::size_t size) override;
+
+private:
+    std::string_view mData;
+};
+
+class FileSource : public ByteSource {
+public:
+    explicit FileSource(std::filesystem::path const& path) : mFile(path, std::ios::binary) {}
+
+    bool        isOpen() const { return mFile.is_open(); }
+    std::size_t read(char* buffer, std::size_t size) override;
+
+private:
+    std::ifstream mFile;
+};
+
+// Inflates a gzip or zlib stream pulled from another source in fixed size chunks
+class InflateSource : public ByteSource {
+public:
+    explicit InflateSource(std::unique_ptr<ByteSource> input);
+    ~InflateSource() override;
+
+    std::size_t read(char* buffer, std::size_t size) override;
+
+private:
+    std::unique_ptr<ByteSource> mInput;
+    std::unique_ptr<z_stream_s> mStream;
+    std::string                 mInputBuffer;
+    bool                        mFinished{false};
+};
+
+} // namespace rapidnbt
@@ -5,7 +5,11 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "FrozenCompoundTag.hpp"
 #include "NativeModule.hpp"
+#include "NbtPatch.hpp"
+#include "NbtSchema.hpp"
+#include "PythonConversion.hpp"
 
 namespace rapidnbt {
 
@@ -15,15 +19,7 @@ void bindCompoundTag(py::module& m) {
     py::class_<nbt::CompoundTag, nbt::Tag>(sm, "CompoundTag")
         .def(py::init<>(), "Construct an empty CompoundTag")
         .def(
-            py::init([](py::dict obj) {
-                auto tag = std::make_unique<nbt::CompoundTag>();
-                for (auto [k, v] : obj) {
-                    std::string key   = py::cast<std::string>(k);
-                    auto&       value = static_cast<py::object&>(v);
-                    tag->set(key, makeNativeTag(value));
-                }
-                return tag;
-            }),
+            py::init([](py::dict const& obj) { return makeNativeCompound(obj); }),
             py::arg("pairs"),
             "Construct from a Dict[str, Any]\nExample:\n    CompoundTag([\" key1 \": 42, \" key2 \": \" value \"])"
         )
@@ -74,8 +70,13 @@ void bindCompoundTag(py::module& m) {
 
         .def("get_type", &nbt::CompoundTag::getType, "Get the NBT type ID (Compound)")
         .def("equals", &nbt::CompoundTag::equals, py::arg("other"), "Check if this tag equals another tag")
-        .def("copy", &nbt::CompoundTag::copy, "Create a deep copy of this tag")
-        .def("hash", &nbt::CompoundTag::hash, "Compute hash value of this tag")
+        .def(
+            "copy",
+            &nbt::CompoundTag::copy,
+            "Create a deep copy of this tag\nThe whole tree is copied, O(n) in the number of tags, move=True on set() or append() and take() "
+            "transfer a tag without copying"
+        )
+        .def("hash", &nbt::CompoundTag::hash, "Compute hash value of this tag\nThe whole tree is hashed on every call, O(n) in the number of tags")
 
         .def(
             "write",
@@ -111,6 +112,29 @@ void bindCompoundTag(py::module& m) {
             "Merge another CompoundTag into this one\n\nArguments:\n    other: CompoundTag to merge from\n    merge_list: If true, merge list contents instead "
             "of replacing"
         )
+        .def(
+            "diff",
+            &NbtPatch::diff,
+            py::arg("other"),
+            py::call_guard<py::gil_scoped_release>(),
+            "Compute the edits turning this compound into another one\nUnchanged subtrees produce no edits, changed list and array ranges become "
+            "splices\nBoth trees are walked in full, unchanged subtrees are compared tag by tag rather than by hash, so the cost is O(n) in "
+            "their size\n\nArgs:\n    other (CompoundTag): Target compound\n\nReturns:\n    NbtPatch"
+        )
+        .def(
+            "apply_patch",
+            [](nbt::CompoundTag& self, NbtPatch const& patch) { patch.apply(self); },
+            py::arg("patch"),
+            "Apply a patch from diff() in place\nThrow NbtPatchError (a ValueError) if this compound does not have the shape the patch "
+            "expects, the edits before the failing one stay applied\n\nArgs:\n    patch (NbtPatch): Patch to apply"
+        )
+        .def(
+            "freeze",
+            &FrozenCompoundTag::freeze,
+            py::call_guard<py::gil_scoped_release>(),
+            "Build an immutable compact copy for read-mostly data\nThe copy uses contiguous storage with inline numbers and hashed key lookup, "
+            "stores each distinct key once, and can be read from many threads\n\nReturns:\n    FrozenCompoundTag"
+        )
         .def("empty", &nbt::CompoundTag::empty, "Check if the compound is empty")
         .def("clear", &nbt::CompoundTag::clear, "Remove all elements from the compound")
         .def("rename", &nbt::CompoundTag::rename, py::arg("old_key"), py::arg("new_key"), "Rename a key in the compound")
@@ -140,10 +164,69 @@ void bindCompoundTag(py::module& m) {
         )
         .def(
             "set",
-            [](nbt::CompoundTag& self, std::string key, py::object const& value) { self[key] = makeNativeTag(value); },
+            [](py::object const& self, std::string key, py::object const& value, bool move) {
+                self.cast<nbt::CompoundTag&>()[key] = move ? takeNativeTag(value, self) : makeNativeTag(value);
+            },
             py::arg("key"),
             py::arg("value"),
-            "Set value in the compound (automatically converted to appropriate tag type)"
+            py::arg("move") = false,
+            "Set value in the compound (automatically converted to appropriate tag type)\n\nArgs:\n    key (str): Key to set\n    value (Any): Value "
+            "to store\n    move (bool): Move the contents of a tag instead of copying them, leaving it an empty tag of the same type (default: False)"
+            "\n\nThrow ValueError if a tag is moved into itself or one of its descendants"
+        )
+        .def(
+            "take",
+            [](nbt::CompoundTag& self, std::string_view key) {
+                if (!self.contains(key)) { throw py::key_error("tag not exist"); }
+                auto tag = takeTag(self.at(key));
+                self.remove(key);
+                return tag;
+            },
+            py::arg("key"),
+            "Remove a key and return its tag without copying it\nReferences obtained earlier to or into the removed tag stay valid and refer to the "
+            "returned tag, an earlier self[key] is left holding an empty tag\nThrow KeyError if not found\n\nReturns:\n    Tag"
+        )
+
+        .def(
+            "query",
+            [](py::object const& self, NbtPath const& path) -> py::object {
+                auto traces = path.trace(self.cast<nbt::CompoundTag&>());
+                return traces.empty() ? py::none() : to_py_path_match(traces.front(), self);
+            },
+            py::arg("path"),
+            "Get the first tag matched by a compiled NbtPath\nReturns:\n    CompoundTagVariant, CompoundTag (empty path), int (array element) or None if "
+            "nothing matches"
+        )
+        .def(
+            "query",
+            [](py::object const& self, std::string_view path) -> py::object {
+                auto traces = NbtPath::parse(path).trace(self.cast<nbt::CompoundTag&>());
+                return traces.empty() ? py::none() : to_py_path_match(traces.front(), self);
+            },
+            py::arg("path"),
+            "Get the first tag matched by a path in /data command syntax\nExample:\n    nbt.query(\"Level.Sections[3].BlockStates\")\n    "
+            "nbt.query(\"Items[{Slot:3b}].id\")\nReturns:\n    CompoundTagVariant, CompoundTag (empty path), int (array element) or None if nothing matches"
+        )
+        .def(
+            "query_all",
+            [](py::object const& self, NbtPath const& path) {
+                py::list result;
+                for (auto const& trace : path.trace(self.cast<nbt::CompoundTag&>())) { result.append(to_py_path_match(trace, self)); }
+                return result;
+            },
+            py::arg("path"),
+            "Get every tag matched by a compiled NbtPath\nReturns:\n    list of CompoundTagVariant, CompoundTag (empty path) or int (array element)"
+        )
+        .def(
+            "query_all",
+            [](py::object const& self, std::string_view path) {
+                py::list result;
+                for (auto const& trace : NbtPath::parse(path).trace(self.cast<nbt::CompoundTag&>())) { result.append(to_py_path_match(trace, self)); }
+                return result;
+            },
+            py::arg("path"),
+            "Get every tag matched by a path in /data command syntax, wildcards ([]) and filters ([{Slot:3b}]) may match many tags\nReturns:\n    list of "
+            "CompoundTagVariant, CompoundTag (empty path) or int (array element)"
         )
 
         .def(
@@ -156,19 +239,40 @@ void bindCompoundTag(py::module& m) {
             "Convert CompoundTag to a Python dictionary"
         )
 
+        .def(
+            "to_python",
+            [](nbt::CompoundTag const& self, ArrayFormat arrays, bool typed_numbers, bool intern_keys) {
+                return makePythonObject(self, {arrays, typed_numbers, intern_keys});
+            },
+            py::arg("arrays")        = ArrayFormat::Bytes,
+            py::arg("typed_numbers") = false,
+            py::arg("intern_keys")   = false,
+            "Convert to plain Python objects (dict, list, int, float, str, bytes) in one native pass\n\nArgs:\n    arrays (ArrayFormat): How byte, int and long "
+            "arrays are returned (default: BYTES, bytes for byte arrays and array.array otherwise)\n    typed_numbers (bool): Return numbers as ctypes "
+            "instances (c_uint8, c_int16, c_int32, c_int64, c_float, c_double) so the tag types survive CompoundTag(dict) (default: False)\n    intern_keys (bool): Intern compound keys with sys.intern so they are shared across "
+            "documents, repeated keys always share one str within a call (default: False)\n\nReturns:\n    dict"
+        )
         .def(
             "to_network_nbt",
-            [](nbt::CompoundTag const& self) { return to_py_bytes(self.toNetworkNbt()); },
+            [](nbt::CompoundTag const& self) {
+                std::string content;
+                {
+                    py::gil_scoped_release release;
+                    content = self.toNetworkNbt();
+                }
+                return to_py_bytes(content);
+            },
             "Serialize to Network NBT format (used in Minecraft networking)"
         )
         .def(
             "to_binary_nbt",
             [](nbt::CompoundTag const& self, bool little_endian, bool header) {
-                if (header) {
-                    return to_py_bytes(self.toBinaryNbtWithHeader(little_endian));
-                } else {
-                    return to_py_bytes(self.toBinaryNbt(little_endian));
+                std::string content;
+                {
+                    py::gil_scoped_release release;
+                    content = header ? self.toBinaryNbtWithHeader(little_endian) : self.toBinaryNbt(little_endian);
                 }
+                return to_py_bytes(content);
             },
             py::arg("little_endian") = true,
             py::arg("header")        = false,
@@ -221,19 +325,38 @@ void bindCompoundTag(py::module& m) {
             "Access the dict value of this tag"
         )
 
+        .def_static(
+            "from_python",
+            [](py::dict const& obj, NbtSchema const* schema) { return schema ? makeNativeCompound(obj, *schema) : makeNativeCompound(obj); },
+            py::arg("obj"),
+            py::arg("schema") = py::none(),
+            "Build a CompoundTag from plain Python objects\nbool, int, float, str, bytes, dict, list and tuple map to ByteTag, IntTag, "
+            "FloatTag, StringTag, ByteArrayTag, CompoundTag and ListTag, ctypes numbers keep their width and array.array of 8, 32 or 64 "
+            "bit integers becomes a ByteArrayTag, IntArrayTag or LongArrayTag\nOnly the output of to_python(typed_numbers=True) round-trips "
+            "exactly, plain numbers turn ByteTag, ShortTag and LongTag into IntTag (LongTag values outside its range raise) and DoubleTag into "
+            "FloatTag\n\nArgs:\n    obj (dict): Dict[str, "
+            "Any] to convert\n    schema (NbtSchema, optional): Tag types for plain values under the keys it names, so no ctypes wrappers "
+            "are needed (default: None)\n\nReturns:\n    CompoundTag"
+        )
         .def_static(
             "from_network_nbt",
-            [](py::buffer value) { return nbt::CompoundTag::fromNetworkNbt(to_cpp_stringview(value)); },
+            [](py::buffer value) {
+                auto                     content = to_cpp_string(value);
+                py::gil_scoped_release release;
+                return nbt::CompoundTag::fromNetworkNbt(content);
+            },
             py::arg("binary_data"),
             "Deserialize from Network NBT format"
         )
         .def_static(
             "from_binary_nbt",
             [](py::buffer value, bool little_endian, bool header) {
+                auto                     content = to_cpp_string(value);
+                py::gil_scoped_release release;
                 if (header) {
-                    return nbt::CompoundTag::fromBinaryNbtWithHeader(to_cpp_stringview(value), little_endian);
+                    return nbt::CompoundTag::fromBinaryNbtWithHeader(content, little_endian);
                 } else {
-                    return nbt::CompoundTag::fromBinaryNbt(to_cpp_stringview(value), little_endian);
+                    return nbt::CompoundTag::fromBinaryNbt(content, little_endian);
                 }
             },
             py::arg("binary_data"),
@@ -241,8 +364,22 @@ void bindCompoundTag(py::module& m) {
             py::arg("header")        = false,
             "Deserialize from Binary NBT format"
         )
-        .def_static("from_snbt", &nbt::CompoundTag::fromSnbt, py::arg("snbt"), py::arg("parsed_length") = std::nullopt, "Parse from String NBT (SNBT) format")
-        .def_static("from_json", &nbt::CompoundTag::fromJson, py::arg("snbt"), py::arg("parsed_length") = std::nullopt, "Parse from JSON string");
+        .def_static(
+            "from_snbt",
+            &nbt::CompoundTag::fromSnbt,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("snbt"),
+            py::arg("parsed_length") = std::nullopt,
+            "Parse from String NBT (SNBT) format"
+        )
+        .def_static(
+            "from_json",
+            &nbt::CompoundTag::fromJson,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("snbt"),
+            py::arg("parsed_length") = std::nullopt,
+            "Parse from JSON string"
+        );
 }
 
 } // namespace rapidnbt
\ No newline at end of file
@@ -6,18 +6,105 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "NativeModule.hpp"
+#include "BufferExport.hpp"
+#include "PythonConversion.hpp"
+#include <tuple>
+#include <typeinfo>
+#include <unordered_set>
 
 namespace rapidnbt {
 
+namespace {
+
+std::unique_ptr<nbt::IntTag> makeIntTag(py::handle obj) {
+    int  overflow = 0;
+    auto value    = PyLong_AsLongLongAndOverflow(obj.ptr(), &overflow);
+    if (value == -1 && PyErr_Occurred()) { throw py::error_already_set(); }
+    // Same range as to_cpp_int<int>: signed min to unsigned max, with unsigned values wrapping
+    if (overflow == 0 && value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<unsigned>::max()) {
+        return std::make_unique<nbt::IntTag>(static_cast<int>(static_cast<unsigned>(value)));
+    }
+    return std::make_unique<nbt::IntTag>(to_cpp_int<int>(py::reinterpret_borrow<py::int_>(obj), "IntTag"));
+}
+
+std::unique_ptr<nbt::ListTag> makeNativeList(py::handle obj) {
+    auto sequence = py::reinterpret_steal<py::object>(PySequence_Fast(obj.ptr(), "expected a sequence"));
+    if (!sequence) { throw py::error_already_set(); }
+    auto size  = PySequence_Fast_GET_SIZE(sequence.ptr());
+    auto items = PySequence_Fast_ITEMS(sequence.ptr());
+    auto tag   = std::make_unique<nbt::ListTag>();
+    tag->reserve(static_cast<std::size_t>(size));
+    for (Py_ssize_t i = 0; i < size; ++i) { tag->push_back(makeNativeTag(py::reinterpret_borrow<py::object>(items[i]))); }
+    tag->checkAndFixElements();
+    return tag;
+}
+
+// array.array of 8, 32 or 64 bit integers, as produced by to_python()
+std::unique_ptr<nbt::Tag> makeNativeArray(py::object const& obj) {
+    auto typecode = obj.attr("typecode").cast<std::string>();
+    auto itemsize = obj.attr("itemsize").cast<std::size_t>();
+    if (typecode.size() == 1 && std::string_view("bBiIlLqQ").contains(typecode.front())) {
+        if (itemsize == 1) {
+            return std::make_unique<nbt::ByteArrayTag>(to_cpp_stringview(obj));
+        } else if (itemsize == 4) {
+            auto tag = std::make_unique<nbt::IntArrayTag>();
+            assign_from_buffer(tag->storage(), obj);
+            return tag;
+        } else if (itemsize == 8) {
+            auto tag = std::make_unique<nbt::LongArrayTag>();
+            assign_from_buffer(tag->storage(), obj);
+            return tag;
+        }
+    }
+    return makeNativeList(obj);
+}
+
+} // namespace
+
+std::unique_ptr<nbt::CompoundTag> makeNativeCompound(py::dict const& obj) {
+    auto       tag   = std::make_unique<nbt::CompoundTag>();
+    PyObject*  key   = nullptr;
+    PyObject*  value = nullptr;
+    Py_ssize_t pos   = 0;
+    while (PyDict_Next(obj.ptr(), &pos, &key, &value)) {
+        tag->set(to_cpp_key(key), makeNativeTag(py::reinterpret_borrow<py::object>(value)));
+    }
+    return tag;
+}
+
 std::unique_ptr<nbt::Tag> makeNativeTag(py::object const& obj) {
+    // Exact builtin types first, they make up almost all of a plain Python tree
+    auto type = Py_TYPE(obj.ptr());
+    if (type == &PyUnicode_Type) {
+        Py_ssize_t size = 0;
+        auto       data = PyUnicode_AsUTF8AndSize(obj.ptr(), &size);
+        if (!data) { throw py::error_already_set(); }
+        return std::make_unique<nbt::StringTag>(std::string(data, static_cast<std::size_t>(size)));
+    } else if (type == &PyLong_Type) {
+        return makeIntTag(obj);
+    } else if (type == &PyDict_Type) {
+        return makeNativeCompound(py::reinterpret_borrow<py::dict>(obj));
+    } else if (type == &PyList_Type || type == &PyTuple_Type) {
+        return makeNativeList(obj);
+    } else if (type == &PyFloat_Type) {
+        return std::make_unique<nbt::FloatTag>(static_cast<float>(PyFloat_AS_DOUBLE(obj.ptr())));
+    } else if (type == &PyBool_Type) {
+        return std::make_unique<nbt::ByteTag>(static_cast<uint8_t>(obj.ptr() == Py_True));
+    } else if (type == &PyBytes_Type) {
+        return std::make_unique<nbt::ByteArrayTag>(std::string_view(PyBytes_AS_STRING(obj.ptr()), static_cast<std::size_t>(PyBytes_GET_SIZE(obj.ptr()))));
+    } else if (obj.is_none()) {
+        return std::make_unique<nbt::EndTag>();
+    }
+
+    // Copy straight from the wrapped tag, casting by value would copy the whole tree once more
     if (py::isinstance<nbt::CompoundTagVariant>(obj)) {
-        return obj.cast<nbt::CompoundTagVariant>().toUniqueCopy();
+        return obj.cast<nbt::CompoundTagVariant const&>().toUniqueCopy();
     } else if (py::isinstance<nbt::Tag>(obj)) {
         return obj.cast<nbt::Tag*>()->copy();
     } else if (py::isinstance<py::bool_>(obj)) {
         return std::make_unique<nbt::ByteTag>(obj.cast<uint8_t>());
     } else if (py::isinstance<py::int_>(obj)) {
-        return std::make_unique<nbt::IntTag>(to_cpp_int<int>(obj, "IntTag"));
+        return makeIntTag(obj);
     } else if (py::isinstance<py::str>(obj)) {
         return std::make_unique<nbt::StringTag>(obj.cast<std::string>());
     } else if (py::isinstance<py::float_>(obj)) {
@@ -25,36 +112,223 @@ std::unique_ptr<nbt::Tag> makeNativeTag(py::object const& obj) {
     } else if (py::isinstance<py::bytes>(obj) || py::isinstance<py::bytearray>(obj)) {
         return std::make_unique<nbt::ByteArrayTag>(nbt::ByteArrayTag(to_cpp_stringview(obj)));
     } else if (py::isinstance<py::dict>(obj)) {
-        auto dict = obj.cast<py::dict>();
-        auto tag  = std::make_unique<nbt::CompoundTag>();
-        for (auto [k, v] : dict) { tag->set(py::cast<std::string>(k), makeNativeTag(static_cast<py::object&>(v))); }
-        return tag;
+        return makeNativeCompound(obj.cast<py::dict>());
     } else if (py::isinstance<py::list>(obj) || py::isinstance<py::tuple>(obj) || py::isinstance<py::array>(obj)) {
-        auto list = obj.cast<std::vector<py::object>>();
-        auto tag  = std::make_unique<nbt::ListTag>();
-        for (auto t : list) { tag->push_back(makeNativeTag(static_cast<py::object&>(t))); }
-        tag->checkAndFixElements();
-        return tag;
-    } else if (py::isinstance<py::none>(obj)) {
-        return std::make_unique<nbt::EndTag>();
+        return makeNativeList(obj);
     }
-    auto ctypes = py::module::import("ctypes");
-    if (py::isinstance(obj, ctypes.attr("c_int8")) || py::isinstance(obj, ctypes.attr("c_uint8"))) {
+    auto const& types = pythonTypes();
+    if (py::isinstance(obj, types.mArray)) {
+        return makeNativeArray(obj);
+    } else if (py::isinstance(obj, types.mInt8) || py::isinstance(obj, types.mUInt8)) {
         return std::make_unique<nbt::ByteTag>(to_cpp_int<uint8_t>(obj.attr("value").cast<py::int_>(), "ByteTag"));
-    } else if (py::isinstance(obj, ctypes.attr("c_int16")) || py::isinstance(obj, ctypes.attr("c_uint16"))) {
+    } else if (py::isinstance(obj, types.mInt16) || py::isinstance(obj, types.mUInt16)) {
         return std::make_unique<nbt::ShortTag>(to_cpp_int<short>(obj.attr("value").cast<py::int_>(), "ShortTag"));
-    } else if (py::isinstance(obj, ctypes.attr("c_int32")) || py::isinstance(obj, ctypes.attr("c_uint32"))) {
+    } else if (py::isinstance(obj, types.mInt32) || py::isinstance(obj, types.mUInt32)) {
         return std::make_unique<nbt::IntTag>(to_cpp_int<int>(obj.attr("value").cast<py::int_>(), "IntTag"));
-    } else if (py::isinstance(obj, ctypes.attr("c_int64")) || py::isinstance(obj, ctypes.attr("c_uint64"))) {
+    } else if (py::isinstance(obj, types.mInt64) || py::isinstance(obj, types.mUInt64)) {
         return std::make_unique<nbt::LongTag>(to_cpp_int<int64_t>(obj.attr("value").cast<py::int_>(), "LongTag"));
-    } else if (py::isinstance(obj, ctypes.attr("c_float"))) {
+    } else if (py::isinstance(obj, types.mFloat)) {
         return std::make_unique<nbt::FloatTag>(obj.attr("value").cast<float>());
-    } else if (py::isinstance(obj, ctypes.attr("c_double"))) {
+    } else if (py::isinstance(obj, types.mDouble)) {
         return std::make_unique<nbt::DoubleTag>(obj.attr("value").cast<double>());
     }
     throw py::type_error(std::format("Invalid tag type: couldn't convert {} instance to any tag type", py_type_name(obj)));
 }
 
+std::unique_ptr<nbt::Tag> releaseTag(nbt::CompoundTagVariant& tag) {
+    return std::visit(
+        [](auto& value) -> std::unique_ptr<nbt::Tag> {
+            // The export count of a buffer view stays with the emptied tag, not the one its storage moves to
+            ensureResizable(value);
+            return std::make_unique<std::decay_t<decltype(value)>>(std::move(value));
+        },
+        tag.mStorage
+    );
+}
+
+std::unique_ptr<nbt::Tag> releaseTag(nbt::Tag& tag) {
+    ensureResizable(tag);
+    // Only exact tag types are moved, derived ones (NbtFile, tags subclassed in Python) keep their contents and are copied
+    auto release = [&]<typename... Ts>(std::variant<Ts...>*) -> std::unique_ptr<nbt::Tag> {
+        std::unique_ptr<nbt::Tag> result;
+        ((typeid(tag) == typeid(Ts) && (result = std::make_unique<Ts>(std::move(static_cast<Ts&>(tag))))) || ...);
+        return result;
+    };
+    auto result = release(static_cast<decltype(nbt::CompoundTagVariant::mStorage)*>(nullptr));
+    return result ? std::move(result) : tag.copy();
+}
+
+namespace {
+
+bool containsTag(nbt::Tag const& tag, nbt::Tag const& target);
+
+bool containsTag(nbt::CompoundTagVariant const& tag, nbt::Tag const& target) {
+    return std::visit([&target](auto const& value) { return containsTag(static_cast<nbt::Tag const&>(value), target); }, tag.mStorage);
+}
+
+bool containsTag(nbt::Tag const& tag, nbt::Tag const& target) {
+    if (&tag == &target) { return true; }
+    if (tag.getType() == nbt::Tag::Type::Compound) {
+        for (auto const& [key, value] : static_cast<nbt::CompoundTag const&>(tag)) {
+            if (containsTag(value, target)) { return true; }
+        }
+    } else if (tag.getType() == nbt::Tag::Type::List) {
+        for (auto const& element : static_cast<nbt::ListTag const&>(tag)) {
+            if (containsTag(element, target)) { return true; }
+        }
+    }
+    return false;
+}
+
+nbt::Tag const* heldTag(nbt::CompoundTagVariant const& tag) noexcept {
+    return std::visit([](auto const& value) -> nbt::Tag const* { return &value; }, tag.mStorage);
+}
+
+// Tag a Python object refers to, nullptr for objects that are not tags
+nbt::Tag const* tagOf(py::handle obj) {
+    if (py::isinstance<nbt::CompoundTagVariant>(obj)) {
+        return heldTag(obj.cast<nbt::CompoundTagVariant const&>());
+    } else if (py::isinstance<nbt::Tag>(obj)) {
+        return &obj.cast<nbt::Tag const&>();
+    }
+    return nullptr;
+}
+
+// A tag wrapper owning its tag is the root of its tree
+bool isRoot(py::handle obj) {
+    return (py::isinstance<nbt::CompoundTagVariant>(obj) || py::isinstance<nbt::Tag>(obj)) && reinterpret_cast<py::detail::instance*>(obj.ptr())->owned;
+}
+
+// Objects kept alive by obj through reference_internal and keep_alive, for a reference that is the object it was reached from
+std::vector<PyObject*> ownersOf(py::handle obj) {
+    return py::detail::with_internals([&obj](py::detail::internals& internals) {
+        auto found = internals.patients.find(obj.ptr());
+        return found == internals.patients.end() ? std::vector<PyObject*>{} : found->second;
+    });
+}
+
+// Whether child is parent itself (a CompoundTagVariant and the tag it holds) or one of its direct elements
+bool isChildOf(nbt::Tag const* child, nbt::Tag const& parent) {
+    if (child == &parent) { return true; }
+    if (parent.getType() == nbt::Tag::Type::Compound) {
+        for (auto const& [key, value] : static_cast<nbt::CompoundTag const&>(parent)) {
+            if (heldTag(value) == child) { return true; }
+        }
+    } else if (parent.getType() == nbt::Tag::Type::List) {
+        auto const& elements = static_cast<nbt::ListTag const&>(parent).storage();
+        auto        address  = reinterpret_cast<std::uintptr_t>(child);
+        return !elements.empty() && address >= reinterpret_cast<std::uintptr_t>(elements.data())
+            && address < reinterpret_cast<std::uintptr_t>(elements.data() + elements.size());
+    }
+    return false;
+}
+
+// Whether source is target or one of its ancestors, found by walking up from target through the references it was reached
+// from, O(depth) and the width of each compound passed. Only when that chain skips a level (a tag moved out of its parent,
+// a reference whose parent is not a tag wrapper) is the source subtree searched instead
+bool isAncestorOf(nbt::Tag const& source, py::handle target) {
+    auto const* targetTag = tagOf(target);
+    auto        complete  = true;
+    // Objects left to walk up from, with the last tag passed and whether each step down to target went to a direct child
+    std::vector<std::tuple<PyObject*, nbt::Tag const*, bool>> pending{{target.ptr(), targetTag, true}};
+    std::unordered_set<PyObject*>                             seen{target.ptr()};
+    while (!pending.empty()) {
+        auto [object, child, linked] = pending.back();
+        pending.pop_back();
+        if (child == &source && linked) { return true; }
+        auto owners = ownersOf(object);
+        if (owners.empty() && !isRoot(object)) { complete = false; }
+        for (auto* owner : owners) {
+            if (!seen.insert(owner).second) { continue; }
+            auto const* tag = tagOf(owner);
+            if (!tag) {
+                // Iterators are passed through to what they were reached from
+                pending.emplace_back(owner, child, linked);
+                continue;
+            }
+            auto direct = isChildOf(child, *tag);
+            complete    = complete && direct;
+            pending.emplace_back(owner, tag, linked && direct);
+        }
+    }
+    return !complete && containsTag(source, *targetTag);
+}
+
+// Whether obj is target or one of the objects keeping it alive
+bool isKeptAliveBy(py::handle target, py::handle obj) {
+    std::vector<PyObject*>        pending{target.ptr()};
+    std::unordered_set<PyObject*> seen{target.ptr()};
+    while (!pending.empty()) {
+        auto* object = pending.back();
+        pending.pop_back();
+        if (object == obj.ptr()) { return true; }
+        for (auto* owner : ownersOf(object)) {
+            if (seen.insert(owner).second) { pending.push_back(owner); }
+        }
+    }
+    return false;
+}
+
+// Python reference to value as a tag inside a tree, if one exists
+py::handle referenceTo(void const* value, std::type_info const& type) {
+    auto* info    = py::detail::get_type_info(type);
+    auto  wrapper = info ? py::handle(py::detail::get_object_handle(value, info)) : py::handle();
+    return wrapper && !reinterpret_cast<py::detail::instance*>(wrapper.ptr())->owned ? wrapper : py::handle();
+}
+
+// Point a reference at replacement before the tag it refers to is removed from its tree, and make it keep owners alive in
+// place of the objects it was reached from, so the references reached through it stay valid
+void rebindReference(py::handle reference, std::type_info const& type, void* replacement, std::initializer_list<py::handle> owners) {
+    auto* info     = py::detail::get_type_info(type);
+    auto* instance = reinterpret_cast<py::detail::instance*>(reference.ptr());
+    auto  holder   = instance->get_value_and_holder(info);
+    // Left unregistered, so a later reference to whatever takes the old place is a new object and replacement keeps its own
+    py::detail::deregister_instance(instance, holder.value_ptr(), info);
+    holder.set_instance_registered(false);
+    holder.value_ptr() = replacement;
+    if (instance->has_patients) { py::detail::clear_patients(reference.ptr()); }
+    for (auto owner : owners) { py::detail::keep_alive_impl(reference, owner); }
+}
+
+} // namespace
+
+std::unique_ptr<nbt::Tag> takeNativeTag(py::object const& obj, py::handle target) {
+    // Moving the target or one of its ancestors would empty the tree before the tag is inserted into it
+    auto take = [&](auto& source, nbt::Tag const& tag) {
+        if (isAncestorOf(tag, target)) { throw py::value_error("Cannot move a tag into itself or one of its descendants"); }
+        auto result = releaseTag(source);
+        // References reached through obj into the moved contents now point into the tree of target, unless that would be a cycle
+        if (!isKeptAliveBy(target, obj)) { py::detail::keep_alive_impl(obj, target); }
+        return result;
+    };
+    if (py::isinstance<nbt::CompoundTagVariant>(obj)) {
+        auto& source = obj.cast<nbt::CompoundTagVariant&>();
+        return take(source, *heldTag(source));
+    } else if (py::isinstance<nbt::Tag>(obj)) {
+        auto& source = obj.cast<nbt::Tag&>();
+        return take(source, source);
+    }
+    return makeNativeTag(obj);
+}
+
+py::object takeTag(nbt::CompoundTagVariant& slot) {
+    auto  tag   = releaseTag(slot);
+    auto* moved = tag.get();
+    auto  taken = py::cast(std::move(tag));
+    std::visit(
+        [&](auto const& value) {
+            using T = std::decay_t<decltype(value)>;
+            if (auto reference = referenceTo(&value, typeid(T))) { rebindReference(reference, typeid(T), static_cast<T*>(moved), {taken}); }
+        },
+        slot.mStorage
+    );
+    if (auto reference = referenceTo(&slot, typeid(nbt::CompoundTagVariant))) {
+        auto empty = py::cast(nbt::CompoundTagVariant{});
+        rebindReference(reference, typeid(nbt::CompoundTagVariant), empty.cast<nbt::CompoundTagVariant*>(), {empty, taken});
+    }
+    return taken;
+}
+
 void bindCompoundTagVariant(py::module& m) {
     auto sm = m.def_submodule("compound_tag_variant", "A warpper of all tags, to provide morden API for NBT");
 
@@ -253,6 +527,19 @@ void bindCompoundTagVariant(py::module& m) {
             "Get list of (key, value) pairs in this tag\nThrow TypeError if wrong type"
         )
 
+        .def(
+            "to_python",
+            [](nbt::CompoundTagVariant const& self, ArrayFormat arrays, bool typed_numbers, bool intern_keys) {
+                return makePythonObject(self, {arrays, typed_numbers, intern_keys});
+            },
+            py::arg("arrays")        = ArrayFormat::Bytes,
+            py::arg("typed_numbers") = false,
+            py::arg("intern_keys")   = false,
+            "Convert to plain Python objects (dict, list, int, float, str, bytes) in one native pass\n\nArgs:\n    arrays (ArrayFormat): How byte, int and long "
+            "arrays are returned (default: BYTES, bytes for byte arrays and array.array otherwise)\n    typed_numbers (bool): Return numbers as ctypes "
+            "instances (c_uint8, c_int16, c_int32, c_int64, c_float, c_double) so the tag types survive CompoundTag(dict) (default: False)\n    intern_keys (bool): Intern compound keys with sys.intern so they are shared across "
+            "documents, repeated keys always share one str within a call (default: False)\n\nReturns:\n    dict, list, int, float, str, bytes, array.array or None"
+        )
         .def(
             "to_snbt",
             &nbt::CompoundTagVariant::toSnbt,
@@ -271,7 +558,12 @@ void bindCompoundTagVariant(py::module& m) {
             "Merge another CompoundTag into this one\n\nArguments:\n    other: CompoundTag to merge from\n    merge_list: If true, merge list contents instead "
             "of replacing"
         )
-        .def("copy", &nbt::CompoundTagVariant::toUniqueCopy, "Create a deep copy of this tag")
+        .def(
+            "copy",
+            &nbt::CompoundTagVariant::toUniqueCopy,
+            "Create a deep copy of this tag\nThe whole tree is copied, O(n) in the number of tags, move=True on set() or append() and take() "
+            "transfer a tag without copying"
+        )
 
         .def(
             "as_tag",
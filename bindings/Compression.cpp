@@ -0,0 +1,252 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "Compression.hpp"
+#include "ParallelFor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <vector>
+#include <zlib.h>
+#ifdef RAPIDNBT_USE_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
+namespace rapidnbt {
+
+namespace {
+
+constexpr std::size_t MAX_CHUNK_SIZE  = 1u << 30;
+constexpr std::size_t BLOCK_SIZE      = 1u << 17;
+constexpr std::size_t DICTIONARY_SIZE = 1u << 15;
+
+// Deflate can not expand data by more than about 1032:1, a stream inflating further is corrupt or hostile
+constexpr std::size_t MAX_INFLATE_RATIO = 1032;
+
+struct CompressedBlock {
+    std::string mData;
+    uLong       mChecksum;
+};
+
+// Raw deflate of one block, ending on a byte boundary (sync flush) unless it is the last one
+std::string deflateBlock(std::string_view input, std::string_view dictionary, int level, bool last) {
+    z_stream stream{};
+    if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) { throw std::runtime_error("failed to initialize zlib deflate stream"); }
+    if (!dictionary.empty()) {
+        deflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size()));
+    }
+    std::string result;
+    result.resize(deflateBound(&stream, static_cast<uLong>(input.size())) + 16);
+    stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+
+    std::size_t produced = 0;
+    int         flush    = last ? Z_FINISH : Z_SYNC_FLUSH;
+    while (true) {
+        if (produced == result.size()) { result.resize(result.size() * 2); }
+        stream.next_out  = reinterpret_cast<Bytef*>(result.data() + produced);
+        stream.avail_out = static_cast<uInt>(result.size() - produced);
+        auto status      = deflate(&stream, flush);
+        produced         = result.size() - stream.avail_out;
+        if (status == Z_STREAM_END || (!last && status == Z_OK && stream.avail_in == 0 && stream.avail_out != 0)) { break; }
+        if (status != Z_OK && status != Z_BUF_ERROR) {
+            deflateEnd(&stream);
+            throw std::runtime_error("failed to deflate content");
+        }
+    }
+    deflateEnd(&stream);
+    result.resize(produced);
+    return result;
+}
+
+void appendBigEndian(std::string& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) { out.push_back(static_cast<char>(value >> shift & 0xFF)); }
+}
+
+void appendLittleEndian(std::string& out, uint32_t value) {
+    for (int shift = 0; shift <= 24; shift += 8) { out.push_back(static_cast<char>(value >> shift & 0xFF)); }
+}
+
+std::size_t maxInflatedSize(std::string_view content) noexcept { return content.size() * MAX_INFLATE_RATIO + 1024; }
+
+std::size_t estimateInflatedSize(std::string_view content) noexcept {
+    auto limit = maxInflatedSize(content);
+    // gzip stores the uncompressed size modulo 2^32 in its trailer, it is input controlled so only trusted up to the limit
+    if (content.size() >= 18 && static_cast<uint8_t>(content[0]) == 0x1F && static_cast<uint8_t>(content[1]) == 0x8B) {
+        auto* trailer = reinterpret_cast<const uint8_t*>(content.data() + content.size() - 4);
+        auto  size    = static_cast<std::size_t>(trailer[0]) | static_cast<std::size_t>(trailer[1]) << 8 | static_cast<std::size_t>(trailer[2]) << 16
+                   | static_cast<std::size_t>(trailer[3]) << 24;
+        if (size > 0 && size <= limit) { return size; }
+    }
+    return std::min(std::max<std::size_t>(content.size() * 4, 1024), limit);
+}
+
+// Double a full output buffer up to the limit, which bounds the retries to about ten, 0 once the limit is reached
+std::size_t grownInflatedSize(std::size_t size, std::size_t limit) noexcept { return size >= limit ? 0 : std::min(size * 2, limit); }
+
+std::optional<ByteBuffer> inflateWithZlib(std::string_view content) {
+    z_stream stream{};
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) { return std::nullopt; }
+
+    auto       limit = maxInflatedSize(content);
+    ByteBuffer result(estimateInflatedSize(content));
+    stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    stream.avail_in = 0;
+
+    std::size_t remainingIn = content.size();
+    std::size_t produced    = 0;
+    int         status      = Z_OK;
+    while (status != Z_STREAM_END) {
+        if (stream.avail_in == 0 && remainingIn > 0) {
+            stream.avail_in  = static_cast<uInt>(std::min(remainingIn, MAX_CHUNK_SIZE));
+            remainingIn     -= stream.avail_in;
+        }
+        if (produced == result.size()) {
+            auto size = grownInflatedSize(result.size(), limit);
+            if (size == 0) { break; }
+            result.resize(size);
+        }
+        auto available   = std::min(result.size() - produced, MAX_CHUNK_SIZE);
+        stream.next_out  = reinterpret_cast<Bytef*>(result.data() + produced);
+        stream.avail_out = static_cast<uInt>(available);
+        status           = inflate(&stream, Z_NO_FLUSH);
+        produced        += available - stream.avail_out;
+        if (status == Z_BUF_ERROR && stream.avail_in == 0 && remainingIn == 0) { break; }
+        if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) { break; }
+    }
+    inflateEnd(&stream);
+    if (status != Z_STREAM_END) { return std::nullopt; }
+    result.resize(produced);
+    return result;
+}
+
+#ifdef RAPIDNBT_USE_LIBDEFLATE
+std::optional<ByteBuffer> inflateWithLibdeflate(std::string_view content) {
+    thread_local std::unique_ptr<libdeflate_decompressor, decltype(&libdeflate_free_decompressor)> decompressor(
+        libdeflate_alloc_decompressor(),
+        &libdeflate_free_decompressor
+    );
+    if (!decompressor) { return std::nullopt; }
+    auto decompressFn = detectCompression(content) == nbt::NbtCompressionType::Gzip ? &libdeflate_gzip_decompress_ex : &libdeflate_zlib_decompress_ex;
+
+    // libdeflate inflates the whole buffer in one call, so retry with a larger output when the estimate is too small
+    auto       limit = maxInflatedSize(content);
+    ByteBuffer result(estimateInflatedSize(content));
+    while (true) {
+        std::size_t consumed = 0;
+        std::size_t produced = 0;
+        auto        status   = decompressFn(decompressor.get(), content.data(), content.size(), result.data(), result.size(), &consumed, &produced);
+        if (status == LIBDEFLATE_SUCCESS) {
+            result.resize(produced);
+            return result;
+        }
+        auto size = grownInflatedSize(result.size(), limit);
+        if (status != LIBDEFLATE_INSUFFICIENT_SPACE || size == 0) { return std::nullopt; }
+        result.resize(size);
+    }
+}
+#endif
+
+std::atomic<InflateBackend> gInflateBackend{defaultInflateBackend()};
+
+} // namespace
+
+nbt::NbtCompressionType detectCompression(std::string_view head) noexcept {
+    if (head.size() < 2) { return nbt::NbtCompressionType::None; }
+    auto first  = static_cast<uint8_t>(head[0]);
+    auto second = static_cast<uint8_t>(head[1]);
+    if (first == 0x1F && second == 0x8B) { return nbt::NbtCompressionType::Gzip; }
+    if ((first & 0x0F) == Z_DEFLATED && (first >> 4) <= 7 && (first << 8 | second) % 31 == 0) { return nbt::NbtCompressionType::Zlib; }
+    return nbt::NbtCompressionType::None;
+}
+
+bool isInflateBackendAvailable(InflateBackend backend) noexcept {
+#ifdef RAPIDNBT_USE_LIBDEFLATE
+    if (backend == InflateBackend::Libdeflate) { return true; }
+#endif
+    return backend == InflateBackend::Zlib;
+}
+
+InflateBackend defaultInflateBackend() noexcept {
+#ifdef RAPIDNBT_USE_LIBDEFLATE
+    return InflateBackend::Libdeflate;
+#else
+    return InflateBackend::Zlib;
+#endif
+}
+
+InflateBackend getInflateBackend() noexcept { return gInflateBackend.load(std::memory_order_relaxed); }
+
+bool setInflateBackend(InflateBackend backend) noexcept {
+    if (!isInflateBackendAvailable(backend)) { return false; }
+    gInflateBackend.store(backend, std::memory_order_relaxed);
+    return true;
+}
+
+std::optional<ByteBuffer> decompress(std::string_view content) {
+    if (detectCompression(content) == nbt::NbtCompressionType::None) { return std::nullopt; }
+#ifdef RAPIDNBT_USE_LIBDEFLATE
+    if (getInflateBackend() == InflateBackend::Libdeflate) { return inflateWithLibdeflate(content); }
+#endif
+    return inflateWithZlib(content);
+}
+
+std::string compressParallel(std::string_view content, nbt::NbtCompressionType type, nbt::NbtCompressionLevel level, std::size_t threads) {
+    auto gzip  = type == nbt::NbtCompressionType::Gzip;
+    auto count = std::max<std::size_t>(1, (content.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+    std::vector<CompressedBlock> blocks(count);
+    std::exception_ptr           error;
+    std::atomic_flag             failed;
+    parallelFor(count, threads, [&](std::size_t index) {
+        auto begin      = index * BLOCK_SIZE;
+        auto input      = content.substr(std::min(begin, content.size()), BLOCK_SIZE);
+        auto dictionary = content.substr(begin - std::min(begin, DICTIONARY_SIZE), std::min(begin, DICTIONARY_SIZE));
+        auto data       = reinterpret_cast<const Bytef*>(input.data());
+        try {
+            blocks[index].mData = deflateBlock(input, dictionary, static_cast<int>(level), index + 1 == count);
+        } catch (...) {
+            if (!failed.test_and_set()) { error = std::current_exception(); }
+            return;
+        }
+        blocks[index].mChecksum = gzip ? crc32(0, data, static_cast<uInt>(input.size())) : adler32(1, data, static_cast<uInt>(input.size()));
+    });
+    if (error) { std::rethrow_exception(error); }
+
+    std::size_t total = 18;
+    for (auto const& block : blocks) { total += block.mData.size(); }
+    std::string result;
+    result.reserve(total);
+    uLong checksum = gzip ? crc32(0, nullptr, 0) : adler32(0, nullptr, 0);
+    if (gzip) {
+        // ID1 ID2 CM FLG MTIME(4) XFL OS
+        result.append("\x1F\x8B\x08\x00\x00\x00\x00\x00\x00\xFF", 10);
+    } else {
+        auto     value  = static_cast<int>(level) == Z_DEFAULT_COMPRESSION ? 6 : static_cast<int>(level);
+        uint32_t flags  = value < 2 ? 0 : value < 6 ? 1 : value == 6 ? 2 : 3;
+        uint32_t header = 0x7800 | flags << 6;
+        header         += 31 - header % 31;
+        result.push_back(static_cast<char>(header >> 8));
+        result.push_back(static_cast<char>(header & 0xFF));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        auto length = static_cast<z_off_t>(std::min(BLOCK_SIZE, content.size() - std::min(i * BLOCK_SIZE, content.size())));
+        checksum    = gzip ? crc32_combine(checksum, blocks[i].mChecksum, length) : adler32_combine(checksum, blocks[i].mChecksum, length);
+        result.append(blocks[i].mData);
+    }
+    if (gzip) {
+        appendLittleEndian(result, static_cast<uint32_t>(checksum));
+        appendLittleEndian(result, static_cast<uint32_t>(content.size()));
+    } else {
+        appendBigEndian(result, static_cast<uint32_t>(checksum));
+    }
+    return result;
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,36 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "ByteBuffer.hpp"
+#include <nbt/NBT.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace rapidnbt {
+
+enum class InflateBackend { Zlib, Libdeflate };
+
+// Libdeflate is only available when the module is built with it (xmake option "libdeflate")
+bool           isInflateBackendAvailable(InflateBackend backend) noexcept;
+InflateBackend defaultInflateBackend() noexcept;
+InflateBackend getInflateBackend() noexcept;
+bool           setInflateBackend(InflateBackend backend) noexcept;
+
+// Detect the compression wrapper from the first bytes of the content
+nbt::NbtCompressionType detectCompression(std::string_view head) noexcept;
+
+// Inflate a whole gzip or zlib stream with the selected backend (the wrapper is detected from the header)
+std::optional<ByteBuffer> decompress(std::string_view content);
+
+// Deflate content into a single gzip or zlib stream, compressing independent blocks on up to `threads` workers
+// (0 = one per hardware thread). Each block is primed with the tail of the previous one, so the ratio stays close to a
+// single-threaded stream
+std::string compressParallel(std::string_view content, nbt::NbtCompressionType type, nbt::NbtCompressionLevel level, std::size_t threads);
+
+} // namespace rapidnbt
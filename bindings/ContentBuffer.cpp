@@ -0,0 +1,84 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "ContentBuffer.hpp"
+#include <fstream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rapidnbt {
+
+ContentBuffer::~ContentBuffer() {
+    if (!mMapping) { return; }
+#ifdef _WIN32
+    UnmapViewOfFile(mMapping);
+    CloseHandle(mMappingHandle);
+#else
+    munmap(mMapping, mSize);
+#endif
+}
+
+std::shared_ptr<ContentBuffer> ContentBuffer::fromString(std::string content) {
+    std::shared_ptr<ContentBuffer> result(new ContentBuffer());
+    result->mStorage = std::move(content);
+    result->mData    = result->mStorage.data();
+    result->mSize    = result->mStorage.size();
+    return result;
+}
+
+std::shared_ptr<ContentBuffer> ContentBuffer::fromBuffer(ByteBuffer content) {
+    std::shared_ptr<ContentBuffer> result(new ContentBuffer());
+    result->mBuffer = std::move(content);
+    result->mData   = result->mBuffer.data();
+    result->mSize   = result->mBuffer.size();
+    return result;
+}
+
+std::shared_ptr<ContentBuffer> ContentBuffer::fromFile(std::filesystem::path const& path, bool fileMemoryMap) {
+    std::error_code ec;
+    auto            size = std::filesystem::file_size(path, ec);
+    if (ec) { return nullptr; }
+    if (fileMemoryMap && size > 0) {
+        std::shared_ptr<ContentBuffer> result(new ContentBuffer());
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) { return nullptr; }
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) { return nullptr; }
+        void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!address) {
+            CloseHandle(mapping);
+            return nullptr;
+        }
+        result->mMappingHandle = mapping;
+#else
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0) { return nullptr; }
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (address == MAP_FAILED) { return nullptr; }
+#endif
+        result->mMapping = address;
+        result->mData    = static_cast<const char*>(address);
+        result->mSize    = size;
+        return result;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file) { return nullptr; }
+    std::string content(size, '\0');
+    if (!file.read(content.data(), static_cast<std::streamsize>(size))) { return nullptr; }
+    return fromString(std::move(content));
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,44 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "ByteBuffer.hpp"
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace rapidnbt {
+
+// Immutable byte buffer which owns either a heap string, a ByteBuffer or a read-only memory mapping of a file
+class ContentBuffer {
+public:
+    ContentBuffer(ContentBuffer const&)            = delete;
+    ContentBuffer& operator=(ContentBuffer const&) = delete;
+    ~ContentBuffer();
+
+    static std::shared_ptr<ContentBuffer> fromString(std::string content);
+    static std::shared_ptr<ContentBuffer> fromBuffer(ByteBuffer content);
+    static std::shared_ptr<ContentBuffer> fromFile(std::filesystem::path const& path, bool fileMemoryMap);
+
+    std::string_view view() const noexcept { return {mData, mSize}; }
+    bool             isMapped() const noexcept { return mMapping != nullptr; }
+
+private:
+    ContentBuffer() = default;
+
+    std::string mStorage{};
+    ByteBuffer  mBuffer{};
+    const char* mData{nullptr};
+    std::size_t mSize{0};
+    void*       mMapping{nullptr};
+#ifdef _WIN32
+    void* mMappingHandle{nullptr};
+#endif
+};
+
+} // namespace rapidnbt
@@ -5,7 +5,9 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "Compression.hpp"
 #include "NativeModule.hpp"
+#include "PythonConversion.hpp"
 
 namespace py = pybind11;
 
@@ -111,6 +113,25 @@ void bindEnums(py::module& m) {
             .export_values()
             .finalize();
     }
+    {
+        auto sm = m.def_submodule("array_format");
+
+        py::native_enum<ArrayFormat>(sm, "ArrayFormat", "enum.Enum", "How to_python() returns byte, int and long arrays")
+            .value("LIST", ArrayFormat::List)
+            .value("BYTES", ArrayFormat::Bytes)
+            .value("ARRAY", ArrayFormat::Array)
+            .export_values()
+            .finalize();
+    }
+    {
+        auto sm = m.def_submodule("inflate_backend");
+
+        py::native_enum<InflateBackend>(sm, "InflateBackend", "enum.Enum", "Decompressors available to the parse functions")
+            .value("ZLIB", InflateBackend::Zlib)
+            .value("LIBDEFLATE", InflateBackend::Libdeflate)
+            .export_values()
+            .finalize();
+    }
 }
 
 } // namespace rapidnbt
\ No newline at end of file
@@ -0,0 +1,434 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "FrozenCompoundTag.hpp"
+#include "NativeModule.hpp"
+#include <bit>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+namespace rapidnbt {
+
+namespace {
+
+// Compounds up to this size are scanned, comparing the stored hashes first, instead of getting index slots
+constexpr std::size_t LINEAR_ENTRIES = 8;
+
+uint32_t hashKey(std::string_view key) noexcept { return static_cast<uint32_t>(std::hash<std::string_view>{}(key)); }
+
+uint32_t checkedSize(std::size_t size) {
+    if (size > std::numeric_limits<uint32_t>::max()) { throw std::length_error("tag is too large to freeze"); }
+    return static_cast<uint32_t>(size);
+}
+
+} // namespace
+
+FrozenDocument::FrozenDocument(nbt::CompoundTag const& root) {
+    freeze(root);
+    mKeyOffsets = decltype(mKeyOffsets){};
+    mCompounds.shrink_to_fit();
+    mEntries.shrink_to_fit();
+    mElements.shrink_to_fit();
+    mSlots.shrink_to_fit();
+    mData.shrink_to_fit();
+}
+
+uint64_t FrozenDocument::append(void const* data, std::size_t size) {
+    auto offset = mData.size();
+    mData.append(static_cast<const char*>(data), size);
+    return offset;
+}
+
+uint64_t FrozenDocument::appendKey(std::string_view key) {
+    // Chunk, entity and palette data repeat the same few keys in every element, so each distinct key is stored once and the
+    // entries share it. The views point into the source tree, which outlives the build
+    auto [found, inserted] = mKeyOffsets.try_emplace(key, 0);
+    if (inserted) { found->second = append(key.data(), key.size()); }
+    return found->second;
+}
+
+FrozenValue FrozenDocument::freeze(nbt::CompoundTagVariant const& tag) {
+    return std::visit(
+        [&](auto const& value) -> FrozenValue {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, nbt::CompoundTag> || std::is_same_v<T, nbt::ListTag>) {
+                return freeze(value);
+            } else if constexpr (std::is_same_v<T, nbt::EndTag>) {
+                return {};
+            } else if constexpr (std::is_same_v<T, nbt::StringTag>) {
+                auto const& storage = value.storage();
+                return {nbt::Tag::Type::String, nbt::Tag::Type::End, checkedSize(storage.size()), append(storage.data(), storage.size())};
+            } else if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value.storage())>>) {
+                FrozenValue result{value.getType()};
+                auto        number = value.storage();
+                std::memcpy(&result.mPayload, &number, sizeof(number));
+                return result;
+            } else {
+                auto const& storage = value.storage();
+                auto        size    = storage.size() * sizeof(*storage.data());
+                return {value.getType(), nbt::Tag::Type::End, checkedSize(storage.size()), append(storage.data(), size)};
+            }
+        },
+        tag.mStorage
+    );
+}
+
+FrozenValue FrozenDocument::freeze(nbt::CompoundTag const& tag) {
+    // Children append their own entries while this compound is visited, so its entries are collected first and stored together
+    auto index = mCompounds.size();
+    mCompounds.emplace_back();
+    std::vector<FrozenEntry> entries;
+    entries.reserve(tag.size());
+    for (auto const& [key, value] : tag) {
+        auto keyOffset = appendKey(key);
+        entries.push_back({keyOffset, checkedSize(key.size()), hashKey(key), freeze(value)});
+    }
+    FrozenCompoundNode node{checkedSize(mEntries.size()), checkedSize(entries.size()), checkedSize(mSlots.size()), 0};
+    mEntries.insert(mEntries.end(), entries.begin(), entries.end());
+    if (entries.size() > LINEAR_ENTRIES) {
+        auto capacity = std::bit_ceil(entries.size() * 2);
+        node.mSlotMask = checkedSize(capacity - 1);
+        mSlots.resize(mSlots.size() + capacity);
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            auto position = entries[i].mHash & node.mSlotMask;
+            while (mSlots[node.mFirstSlot + position] != 0) { position = (position + 1) & node.mSlotMask; }
+            mSlots[node.mFirstSlot + position] = static_cast<uint32_t>(i + 1);
+        }
+    }
+    mCompounds[index] = node;
+    return {nbt::Tag::Type::Compound, nbt::Tag::Type::End, node.mSize, index};
+}
+
+FrozenValue FrozenDocument::freeze(nbt::ListTag const& tag) {
+    // The element range is reserved up front, nested lists append theirs after it
+    auto first = mElements.size();
+    mElements.resize(first + tag.size());
+    std::size_t index = first;
+    for (auto const& element : tag) {
+        auto value        = freeze(element);
+        mElements[index++] = value;
+    }
+    return {nbt::Tag::Type::List, tag.getElementType(), checkedSize(tag.size()), first};
+}
+
+FrozenEntry const* FrozenDocument::find(std::size_t compound, std::string_view key) const noexcept {
+    auto const& node  = mCompounds[compound];
+    auto const* first = mEntries.data() + node.mFirstEntry;
+    auto        hash  = hashKey(key);
+    if (node.mSlotMask == 0) {
+        for (auto const* entry = first; entry != first + node.mSize; ++entry) {
+            if (entry->mHash == hash && this->key(*entry) == key) { return entry; }
+        }
+        return nullptr;
+    }
+    for (auto position = hash & node.mSlotMask;; position = (position + 1) & node.mSlotMask) {
+        auto slot = mSlots[node.mFirstSlot + position];
+        if (slot == 0) { return nullptr; }
+        auto const* entry = first + slot - 1;
+        if (entry->mHash == hash && this->key(*entry) == key) { return entry; }
+    }
+}
+
+std::size_t FrozenDocument::memoryUsage() const noexcept {
+    return sizeof(*this) + mCompounds.capacity() * sizeof(FrozenCompoundNode) + mEntries.capacity() * sizeof(FrozenEntry)
+         + mElements.capacity() * sizeof(FrozenValue) + mSlots.capacity() * sizeof(uint32_t) + mData.capacity();
+}
+
+std::unique_ptr<nbt::Tag> FrozenDocument::materialize(FrozenValue const& value) const {
+    switch (value.mType) {
+    case nbt::Tag::Type::Byte:
+        return std::make_unique<nbt::ByteTag>(value.number<uint8_t>());
+    case nbt::Tag::Type::Short:
+        return std::make_unique<nbt::ShortTag>(value.number<short>());
+    case nbt::Tag::Type::Int:
+        return std::make_unique<nbt::IntTag>(value.number<int>());
+    case nbt::Tag::Type::Long:
+        return std::make_unique<nbt::LongTag>(value.number<int64_t>());
+    case nbt::Tag::Type::Float:
+        return std::make_unique<nbt::FloatTag>(value.number<float>());
+    case nbt::Tag::Type::Double:
+        return std::make_unique<nbt::DoubleTag>(value.number<double>());
+    case nbt::Tag::Type::String:
+        return std::make_unique<nbt::StringTag>(std::string(string(value)));
+    case nbt::Tag::Type::ByteArray:
+        return std::make_unique<nbt::ByteArrayTag>(string(value));
+    case nbt::Tag::Type::IntArray: {
+        auto tag = std::make_unique<nbt::IntArrayTag>();
+        tag->storage().resize(value.mSize);
+        std::memcpy(tag->storage().data(), mData.data() + value.mPayload, value.mSize * sizeof(int32_t));
+        return tag;
+    }
+    case nbt::Tag::Type::LongArray: {
+        auto tag = std::make_unique<nbt::LongArrayTag>();
+        tag->storage().resize(value.mSize);
+        std::memcpy(tag->storage().data(), mData.data() + value.mPayload, value.mSize * sizeof(int64_t));
+        return tag;
+    }
+    case nbt::Tag::Type::List: {
+        auto tag = std::make_unique<nbt::ListTag>();
+        for (std::size_t i = 0; i < value.mSize; ++i) { tag->push_back(materialize(mElements[value.mPayload + i])); }
+        return tag;
+    }
+    case nbt::Tag::Type::Compound: {
+        auto        tag  = std::make_unique<nbt::CompoundTag>();
+        auto const& node = mCompounds[value.mPayload];
+        for (std::size_t i = 0; i < node.mSize; ++i) {
+            auto const& entry = mEntries[node.mFirstEntry + i];
+            (*tag)[key(entry)] = materialize(entry.mValue);
+        }
+        return tag;
+    }
+    default:
+        return std::make_unique<nbt::EndTag>();
+    }
+}
+
+FrozenCompoundTag FrozenCompoundTag::freeze(nbt::CompoundTag const& root) { return {std::make_shared<FrozenDocument const>(root), 0}; }
+
+nbt::CompoundTag FrozenCompoundTag::materialize() const {
+    auto tag = mDocument->materialize({nbt::Tag::Type::Compound, nbt::Tag::Type::End, node().mSize, mIndex});
+    return std::move(static_cast<nbt::CompoundTag&>(*tag));
+}
+
+nbt::ListTag FrozenListTag::materialize() const {
+    auto tag = mDocument->materialize(mValue);
+    return std::move(static_cast<nbt::ListTag&>(*tag));
+}
+
+namespace {
+
+py::object frozenValue(std::shared_ptr<FrozenDocument const> const& document, FrozenValue const& value) {
+    switch (value.mType) {
+    case nbt::Tag::Type::Compound:
+        return py::cast(FrozenCompoundTag(document, value.mPayload));
+    case nbt::Tag::Type::List:
+        return py::cast(FrozenListTag(document, value));
+    default:
+        return py::cast(nbt::CompoundTagVariant(document->materialize(value)));
+    }
+}
+
+FrozenEntry const& frozenEntry(FrozenCompoundTag const& self, std::string_view key) {
+    auto* entry = self.find(key);
+    if (!entry) { throw py::key_error(std::string(key)); }
+    return *entry;
+}
+
+// Inline number stored at key, checked against the expected tag type
+template <typename T>
+T frozenNumber(FrozenCompoundTag const& self, std::string_view key, nbt::Tag::Type type, std::string_view name) {
+    auto const& value = frozenEntry(self, key).mValue;
+    if (value.mType != type) { throw py::type_error(std::format("tag at key \"{}\" is not a {}", key, name)); }
+    return value.number<T>();
+}
+
+py::list frozenKeys(FrozenCompoundTag const& self) {
+    py::list keys;
+    for (std::size_t i = 0; i < self.size(); ++i) { keys.append(to_py_text(self.document()->key(self.entryAt(i)))); }
+    return keys;
+}
+
+} // namespace
+
+void bindFrozenCompoundTag(py::module& m) {
+    auto sm = m.def_submodule("frozen_compound_tag", "Immutable compact copies of CompoundTag trees for read-mostly data");
+
+    py::class_<FrozenCompoundTag>(sm, "FrozenCompoundTag")
+        .def(
+            "__getitem__",
+            [](FrozenCompoundTag const& self, std::string_view key) { return frozenValue(self.document(), frozenEntry(self, key).mValue); },
+            py::arg("key"),
+            "Get value by key\nCompounds and lists stay frozen, other tags are built on access\nThrow KeyError if not found"
+        )
+        .def(
+            "get",
+            [](FrozenCompoundTag const& self, std::string_view key) { return frozenValue(self.document(), frozenEntry(self, key).mValue); },
+            py::arg("key"),
+            "Get value by key\nCompounds and lists stay frozen, other tags are built on access\nThrow KeyError if not found"
+        )
+        .def(
+            "contains",
+            [](FrozenCompoundTag const& self, std::string_view key) { return self.find(key) != nullptr; },
+            py::arg("key"),
+            "Check if key exists"
+        )
+        .def(
+            "contains",
+            [](FrozenCompoundTag const& self, std::string_view key, nbt::Tag::Type type) {
+                auto* entry = self.find(key);
+                return entry && entry->mValue.mType == type;
+            },
+            py::arg("key"),
+            py::arg("type"),
+            "Check if key exists and value type is the specific type"
+        )
+        .def(
+            "get_type",
+            [](FrozenCompoundTag const& self, std::string_view key) { return frozenEntry(self, key).mValue.mType; },
+            py::arg("key"),
+            "Get the tag type stored at key\nThrow KeyError if not found"
+        )
+        .def(
+            "get_byte",
+            [](FrozenCompoundTag const& self, std::string_view key, bool isSigned) -> py::int_ {
+                auto value = frozenNumber<uint8_t>(self, key, nbt::Tag::Type::Byte, "ByteTag");
+                return isSigned ? static_cast<int8_t>(value) : value;
+            },
+            py::arg("key"),
+            py::arg("signed") = false,
+            "Get the byte value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def(
+            "get_short",
+            [](FrozenCompoundTag const& self, std::string_view key, bool isSigned) -> py::int_ {
+                auto value = frozenNumber<short>(self, key, nbt::Tag::Type::Short, "ShortTag");
+                return isSigned ? value : static_cast<uint16_t>(value);
+            },
+            py::arg("key"),
+            py::arg("signed") = true,
+            "Get the short value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def(
+            "get_int",
+            [](FrozenCompoundTag const& self, std::string_view key, bool isSigned) -> py::int_ {
+                auto value = frozenNumber<int>(self, key, nbt::Tag::Type::Int, "IntTag");
+                return isSigned ? value : static_cast<uint32_t>(value);
+            },
+            py::arg("key"),
+            py::arg("signed") = true,
+            "Get the int value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def(
+            "get_long",
+            [](FrozenCompoundTag const& self, std::string_view key, bool isSigned) -> py::int_ {
+                auto value = frozenNumber<int64_t>(self, key, nbt::Tag::Type::Long, "LongTag");
+                return isSigned ? value : static_cast<uint64_t>(value);
+            },
+            py::arg("key"),
+            py::arg("signed") = true,
+            "Get the int64 value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def(
+            "get_float",
+            [](FrozenCompoundTag const& self, std::string_view key) { return frozenNumber<float>(self, key, nbt::Tag::Type::Float, "FloatTag"); },
+            py::arg("key"),
+            "Get the float value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def(
+            "get_double",
+            [](FrozenCompoundTag const& self, std::string_view key) { return frozenNumber<double>(self, key, nbt::Tag::Type::Double, "DoubleTag"); },
+            py::arg("key"),
+            "Get the double value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def(
+            "get_string",
+            [](FrozenCompoundTag const& self, std::string_view key) {
+                auto const& value = frozenEntry(self, key).mValue;
+                if (value.mType != nbt::Tag::Type::String) { throw py::type_error(std::format("tag at key \"{}\" is not a StringTag", key)); }
+                return to_py_text(self.document()->string(value));
+            },
+            py::arg("key"),
+            "Get the string value at key\nThrow KeyError if not found, TypeError if wrong type"
+        )
+        .def("size", &FrozenCompoundTag::size, "Get the size of the compound")
+        .def("keys", &frozenKeys, "Get list of all keys in the compound")
+        .def(
+            "values",
+            [](FrozenCompoundTag const& self) {
+                py::list values;
+                for (std::size_t i = 0; i < self.size(); ++i) { values.append(frozenValue(self.document(), self.entryAt(i).mValue)); }
+                return values;
+            },
+            "Get list of all values in the compound"
+        )
+        .def(
+            "items",
+            [](FrozenCompoundTag const& self) {
+                py::list items;
+                for (std::size_t i = 0; i < self.size(); ++i) {
+                    auto const& entry = self.entryAt(i);
+                    items.append(py::make_tuple(to_py_text(self.document()->key(entry)), frozenValue(self.document(), entry.mValue)));
+                }
+                return items;
+            },
+            "Get list of (key, value) pairs in the compound"
+        )
+        .def(
+            "memory_usage",
+            [](FrozenCompoundTag const& self) { return self.document()->memoryUsage(); },
+            "Get the number of bytes held by the whole frozen document"
+        )
+        .def(
+            "materialize",
+            &FrozenCompoundTag::materialize,
+            py::call_guard<py::gil_scoped_release>(),
+            "Build a mutable CompoundTag copy of the compound"
+        )
+        .def(
+            "to_snbt",
+            [](FrozenCompoundTag const& self, nbt::SnbtFormat format, uint8_t indent, nbt::SnbtNumberFormat number_format) {
+                py::gil_scoped_release release;
+                return self.materialize().toSnbt(format, indent, number_format);
+            },
+            py::arg("format")        = nbt::SnbtFormat::Default,
+            py::arg("indent")        = 4,
+            py::arg("number_format") = nbt::SnbtNumberFormat::Default,
+            "Convert tag to SNBT string"
+        )
+
+        .def("__contains__", [](FrozenCompoundTag const& self, std::string_view key) { return self.find(key) != nullptr; }, py::arg("key"))
+        .def("__len__", &FrozenCompoundTag::size, "Get number of key-value pairs")
+        .def("__iter__", [](FrozenCompoundTag const& self) { return py::iter(frozenKeys(self)); }, "Iterate over keys in the compound")
+        .def(
+            "__str__",
+            [](FrozenCompoundTag const& self) { return self.materialize().toSnbt(nbt::SnbtFormat::Minimize); },
+            "String representation (SNBT minimized format)"
+        )
+        .def(
+            "__repr__",
+            [](FrozenCompoundTag const& self) { return std::format("<rapidnbt.FrozenCompoundTag(size={0}) object at 0x{1:0{2}X}>", self.size(), ADDRESS); },
+            "Official string representation"
+        );
+
+    py::class_<FrozenListTag>(sm, "FrozenListTag")
+        .def(
+            "__getitem__",
+            [](FrozenListTag const& self, std::size_t index) {
+                if (index >= self.size()) { throw py::index_error("Index out of range"); }
+                return frozenValue(self.document(), self.elementAt(index));
+            },
+            py::arg("index"),
+            "Get element at specified index\nCompounds and lists stay frozen, other tags are built on access"
+        )
+        .def("size", &FrozenListTag::size, "Get number of elements in the list")
+        .def("get_element_type", &FrozenListTag::getElementType, "Get the type of elements in this list")
+        .def(
+            "to_list",
+            [](FrozenListTag const& self) {
+                py::list result;
+                for (std::size_t i = 0; i < self.size(); ++i) { result.append(frozenValue(self.document(), self.elementAt(i))); }
+                return result;
+            },
+            "Get the elements as a list"
+        )
+        .def("materialize", &FrozenListTag::materialize, py::call_guard<py::gil_scoped_release>(), "Build a mutable ListTag copy of the list")
+
+        .def("__len__", &FrozenListTag::size, "Get number of elements in the list")
+        .def(
+            "__str__",
+            [](FrozenListTag const& self) { return self.materialize().toSnbt(nbt::SnbtFormat::Minimize); },
+            "String representation (SNBT minimized format)"
+        )
+        .def(
+            "__repr__",
+            [](FrozenListTag const& self) { return std::format("<rapidnbt.FrozenListTag(size={0}) object at 0x{1:0{2}X}>", self.size(), ADDRESS); },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,123 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <nbt/NBT.hpp>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rapidnbt {
+
+// One tag of a frozen tree. Numbers are stored inline, strings and arrays as an offset into the document data, compounds as
+// the index of their FrozenCompoundNode and lists as the index of their first element
+struct FrozenValue {
+    nbt::Tag::Type mType{nbt::Tag::Type::End};
+    nbt::Tag::Type mElementType{nbt::Tag::Type::End};
+    uint32_t       mSize{0};
+    uint64_t       mPayload{0};
+
+    template <typename T>
+    T number() const noexcept {
+        T value;
+        std::memcpy(&value, &mPayload, sizeof(T));
+        return value;
+    }
+};
+
+struct FrozenEntry {
+    uint64_t    mKeyOffset;
+    uint32_t    mKeySize;
+    uint32_t    mHash;
+    FrozenValue mValue;
+};
+
+// Entries of a compound are contiguous, compounds above a few entries also own a power-of-two range of index slots holding
+// entry number + 1 (0 for empty slots), probed linearly
+struct FrozenCompoundNode {
+    uint32_t mFirstEntry;
+    uint32_t mSize;
+    uint32_t mFirstSlot;
+    uint32_t mSlotMask;
+};
+
+// Immutable, contiguous copy of a CompoundTag tree, shared by every FrozenCompoundTag and FrozenListTag built from it
+// Nothing is modified after construction, so a document can be read from any number of threads without locking
+class FrozenDocument {
+public:
+    explicit FrozenDocument(nbt::CompoundTag const& root);
+
+    FrozenCompoundNode const& compound(std::size_t index) const noexcept { return mCompounds[index]; }
+    FrozenEntry const&        entry(std::size_t index) const noexcept { return mEntries[index]; }
+    FrozenValue const&        element(std::size_t index) const noexcept { return mElements[index]; }
+
+    std::string_view   key(FrozenEntry const& entry) const noexcept { return {mData.data() + entry.mKeyOffset, entry.mKeySize}; }
+    std::string_view   string(FrozenValue const& value) const noexcept { return {mData.data() + value.mPayload, value.mSize}; }
+    FrozenEntry const* find(std::size_t compound, std::string_view key) const noexcept;
+    std::size_t        memoryUsage() const noexcept;
+
+    // Build a mutable copy of a frozen value
+    std::unique_ptr<nbt::Tag> materialize(FrozenValue const& value) const;
+
+private:
+    FrozenValue freeze(nbt::CompoundTagVariant const& tag);
+    FrozenValue freeze(nbt::CompoundTag const& tag);
+    FrozenValue freeze(nbt::ListTag const& tag);
+    uint64_t    append(void const* data, std::size_t size);
+    uint64_t    appendKey(std::string_view key);
+
+    std::vector<FrozenCompoundNode> mCompounds;
+    std::vector<FrozenEntry>        mEntries;
+    std::vector<FrozenValue>        mElements;
+    std::vector<uint32_t>           mSlots;
+    std::string                     mData;
+    // Offset of every distinct key stored so far, only filled while the document is built
+    std::unordered_map<std::string_view, uint64_t> mKeyOffsets;
+};
+
+// Read-only compound inside a FrozenDocument
+class FrozenCompoundTag {
+public:
+    FrozenCompoundTag(std::shared_ptr<FrozenDocument const> document, std::size_t index) : mDocument(std::move(document)), mIndex(index) {}
+
+    static FrozenCompoundTag freeze(nbt::CompoundTag const& root);
+
+    std::size_t               size() const noexcept { return node().mSize; }
+    FrozenEntry const&        entryAt(std::size_t position) const noexcept { return mDocument->entry(node().mFirstEntry + position); }
+    FrozenEntry const*        find(std::string_view key) const noexcept { return mDocument->find(mIndex, key); }
+    FrozenCompoundNode const& node() const noexcept { return mDocument->compound(mIndex); }
+    nbt::CompoundTag          materialize() const;
+
+    std::shared_ptr<FrozenDocument const> const& document() const noexcept { return mDocument; }
+
+private:
+    std::shared_ptr<FrozenDocument const> mDocument;
+    std::size_t                           mIndex;
+};
+
+// Read-only list inside a FrozenDocument
+class FrozenListTag {
+public:
+    FrozenListTag(std::shared_ptr<FrozenDocument const> document, FrozenValue const& value) : mDocument(std::move(document)), mValue(value) {}
+
+    std::size_t        size() const noexcept { return mValue.mSize; }
+    nbt::Tag::Type     getElementType() const noexcept { return mValue.mElementType; }
+    FrozenValue const& elementAt(std::size_t index) const noexcept { return mDocument->element(mValue.mPayload + index); }
+    nbt::ListTag       materialize() const;
+
+    std::shared_ptr<FrozenDocument const> const& document() const noexcept { return mDocument; }
+
+private:
+    std::shared_ptr<FrozenDocument const> mDocument;
+    FrozenValue                           mValue;
+};
+
+} // namespace rapidnbt
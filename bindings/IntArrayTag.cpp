@@ -5,6 +5,7 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "BufferExport.hpp"
 #include "NativeModule.hpp"
 
 namespace rapidnbt {
@@ -12,8 +13,18 @@ namespace rapidnbt {
 void bindIntArrayTag(py::module& m) {
     auto sm = m.def_submodule("int_array_tag", "A tag contains an int array");
 
-    py::class_<nbt::IntArrayTag, nbt::Tag>(sm, "IntArrayTag")
+    py::class_<nbt::IntArrayTag, nbt::Tag>(sm, "IntArrayTag", py::buffer_protocol())
+        .def_buffer([](nbt::IntArrayTag& self) { return exportBuffer(self, self.storage()); })
         .def(py::init<>(), "Construct an empty IntArrayTag")
+        .def(
+            py::init([](py::buffer buf) {
+                auto result = std::make_unique<nbt::IntArrayTag>();
+                assign_from_buffer(result->storage(), buf);
+                return result;
+            }),
+            py::arg("buf"),
+            "Construct from a buffer of 4-byte integers (e.g. numpy array)\nContiguous native integers of the same width are copied with a single memcpy"
+        )
         .def(py::init<std::vector<int> const&>(), py::arg("values"), "Construct from a list of integers", "Example:", "    IntArrayTag([1, 2, 3]))")
 
         .def("get_type", &nbt::IntArrayTag::getType, "Get the NBT type ID (int array)")
@@ -28,7 +39,10 @@ void bindIntArrayTag(py::module& m) {
         )
         .def(
             "load",
-            [](nbt::IntArrayTag& self, bstream::ReadOnlyBinaryStream& stream) { self.load(stream); },
+            [](nbt::IntArrayTag& self, bstream::ReadOnlyBinaryStream& stream) {
+                ensureResizable(self);
+                self.load(stream);
+            },
             py::arg("stream"),
             "Load int array from a binary stream"
         )
@@ -41,11 +55,21 @@ void bindIntArrayTag(py::module& m) {
         )
         .def(
             "reserve",
-            &nbt::IntArrayTag::reserve,
+            [](nbt::IntArrayTag& self, std::size_t capacity) {
+                ensureResizable(self);
+                self.reserve(capacity);
+            },
             py::arg("capacity"),
             "Reserve storage capacity for the array\n\nArguments:\n    capacity: Minimum capacity to reserv)"
         )
-        .def("clear", &nbt::IntArrayTag::clear, "Remove all elements from the array")
+        .def(
+            "clear",
+            [](nbt::IntArrayTag& self) {
+                ensureResizable(self);
+                self.clear();
+            },
+            "Remove all elements from the array"
+        )
         .def(
             "__getitem__",
             [](nbt::IntArrayTag const& self, size_t index) {
@@ -65,24 +89,50 @@ void bindIntArrayTag(py::module& m) {
             py::arg("value"),
             "Set element at index"
         )
-        .def("append", &nbt::IntArrayTag::push_back, py::arg("value"), "Append an integer to the end of the array")
+        .def(
+            "append",
+            [](nbt::IntArrayTag& self, int value) {
+                ensureResizable(self);
+                self.push_back(value);
+            },
+            py::arg("value"),
+            "Append an integer to the end of the array"
+        )
         .def(
             "pop",
-            py::overload_cast<size_t>(&nbt::IntArrayTag::remove),
+            [](nbt::IntArrayTag& self, size_t index) {
+                ensureResizable(self);
+                return self.remove(index);
+            },
             py::arg("index"),
             "Remove element at specified index\nReturns:    True if successful, False if index out of range"
         )
         .def(
             "pop",
-            py::overload_cast<size_t, size_t>(&nbt::IntArrayTag::remove),
+            [](nbt::IntArrayTag& self, size_t start, size_t end) {
+                ensureResizable(self);
+                return self.remove(start, end);
+            },
             py::arg("start_index"),
             py::arg("end_index"),
             "Remove elements in the range [start_index, end_index)\n\nArguments:\n    start_index: First index to remove (inclusive)\n    end_index: End index "
             "(exclusive)\n\nReturns:\n     True if successful, False if indices out of range)"
         )
+        .def(
+            "assign",
+            [](nbt::IntArrayTag& self, py::buffer buf) -> nbt::IntArrayTag& {
+                ensureResizable(self);
+                assign_from_buffer(self.storage(), buf);
+                return self;
+            },
+            py::arg("buf"),
+            py::return_value_policy::reference_internal,
+            "Assign new values from a buffer of 4-byte integers (e.g. numpy array)\nContiguous native integers of the same width are copied with a single memcpy\nReturns the modified array"
+        )
         .def(
             "assign",
             [](nbt::IntArrayTag& self, std::vector<int> const& values) {
+                ensureResizable(self);
                 self = values;
                 return self;
             },
@@ -93,7 +143,10 @@ void bindIntArrayTag(py::module& m) {
         .def_property(
             "value",
             [](nbt::IntArrayTag& self) -> std::vector<int> { return self.storage(); },
-            [](nbt::IntArrayTag& self, std::vector<int> const& value) { self.storage() = value; },
+            [](nbt::IntArrayTag& self, std::vector<int> const& value) {
+                ensureResizable(self);
+                self.storage() = value;
+            },
             "Access the int array as a list of integers"
         )
 
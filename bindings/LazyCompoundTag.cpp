@@ -0,0 +1,569 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "LazyCompoundTag.hpp"
+#include "Compression.hpp"
+#include "NativeModule.hpp"
+#include <bit>
+
+namespace rapidnbt {
+
+namespace {
+
+void applyWrites(LazyWrites& write, nbt::CompoundTagVariant& value);
+
+void applyWrites(std::vector<LazyWrites>& writes, nbt::CompoundTag& target) {
+    for (auto& write : writes) { applyWrites(write, target[write.mKey]); }
+}
+
+void applyWrites(std::vector<LazyWrites>& writes, nbt::ListTag& target) {
+    for (auto& write : writes) { applyWrites(write, target[write.mIndex]); }
+}
+
+void applyWrites(LazyWrites& write, nbt::CompoundTagVariant& value) {
+    if (write.mArray) {
+        value = std::move(write.mArray);
+    } else if (value.hold(nbt::Tag::Type::Compound)) {
+        applyWrites(write.mChildren, value.as<nbt::CompoundTag>());
+    } else {
+        applyWrites(write.mChildren, value.as<nbt::ListTag>());
+    }
+}
+
+} // namespace
+
+LazyDocument::LazyDocument(std::shared_ptr<ContentBuffer> buffer, nbt::NbtFileFormat format)
+: mBuffer(std::move(buffer)),
+  mPayloadFormat(payloadFormatOf(encodingOf(format))),
+  mEncoding(encodingOf(format)) {}
+
+nbt::CompoundTagVariant LazyDocument::materialize(nbt::Tag::Type type, std::size_t begin, std::size_t end) const {
+    // Wrap the payload as the only child of an anonymous root compound, then let the nbt parser build it
+    auto        payload   = content().substr(begin, end - begin);
+    std::size_t nameWidth = mEncoding == NbtEncoding::Network ? 1 : 2;
+    std::string wrapped;
+    wrapped.reserve(payload.size() + 2 * nameWidth + 3);
+    wrapped.push_back(static_cast<char>(nbt::Tag::Type::Compound));
+    wrapped.append(nameWidth, '\0');
+    wrapped.push_back(static_cast<char>(type));
+    wrapped.append(nameWidth, '\0');
+    wrapped.append(payload);
+    wrapped.push_back(static_cast<char>(nbt::Tag::Type::End));
+    auto root = nbt::io::parseFromContent(wrapped, mPayloadFormat, true);
+    if (!root || !root->contains("")) { throw NbtFormatError("failed to materialize nbt payload"); }
+    return std::move(root->at(""));
+}
+
+LazyCompoundTag::LazyCompoundTag(std::shared_ptr<LazyDocument const> document, std::size_t begin)
+: mDocument(std::move(document)),
+  mBegin(begin) {
+    NbtReader reader(mDocument->content(), mDocument->encoding(), begin);
+    for (auto type = reader.readType(); type != nbt::Tag::Type::End; type = reader.readType()) {
+        auto key   = reader.readString();
+        auto start = reader.position();
+        reader.skipPayload(type);
+        mIndex[key] = mEntries.size();
+        mEntries.emplace_back(key, type, start, reader.position());
+    }
+    mEnd = reader.position();
+}
+
+std::shared_ptr<LazyCompoundTag>
+LazyCompoundTag::load(std::shared_ptr<ContentBuffer> buffer, std::optional<nbt::NbtFileFormat> format, bool strictMatchSize) {
+    if (!buffer) { return nullptr; }
+    if (detectCompression(buffer->view()) != nbt::NbtCompressionType::None) {
+        auto content = decompress(buffer->view());
+        if (!content) { return nullptr; }
+        buffer = ContentBuffer::fromBuffer(std::move(*content));
+    }
+    if (!format) { format = nbt::io::detectContentFormat(buffer->view(), strictMatchSize); }
+    if (!format) { return nullptr; }
+    try {
+        auto      document = std::make_shared<LazyDocument const>(buffer, *format);
+        NbtReader reader(document->content(), document->encoding(), headerSizeOf(*format));
+        if (reader.readType() != nbt::Tag::Type::Compound) { return nullptr; }
+        reader.readString();
+        auto result = std::make_shared<LazyCompoundTag>(document, reader.position());
+        if (strictMatchSize && result->end() != document->content().size()) { return nullptr; }
+        return result;
+    } catch (NbtFormatError const&) { return nullptr; }
+}
+
+LazyEntry const* LazyCompoundTag::find(std::string_view key) const {
+    auto iter = mIndex.find(key);
+    return iter == mIndex.end() ? nullptr : &mEntries[iter->second];
+}
+
+std::shared_ptr<LazyCompoundTag> LazyCompoundTag::compoundAt(std::size_t index) const {
+    auto& cached = mCompounds[index];
+    if (!cached) { cached = std::make_shared<LazyCompoundTag>(mDocument, mEntries[index].mBegin); }
+    return cached;
+}
+
+std::shared_ptr<LazyListTag> LazyCompoundTag::listAt(std::size_t index) const {
+    auto& cached = mLists[index];
+    if (!cached) { cached = std::make_shared<LazyListTag>(mDocument, mEntries[index].mBegin, mEntries[index].mEnd); }
+    return cached;
+}
+
+std::shared_ptr<LazyArrayTag> LazyCompoundTag::arrayAt(std::size_t index) const {
+    auto& cached = mArrays[index];
+    if (!cached) { cached = std::make_shared<LazyArrayTag>(mDocument, mEntries[index].mType, mEntries[index].mBegin); }
+    return cached;
+}
+
+nbt::CompoundTagVariant LazyCompoundTag::valueAt(std::size_t index) const {
+    auto const&             entry = mEntries[index];
+    auto                    value = mDocument->materialize(entry.mType, entry.mBegin, entry.mEnd);
+    std::vector<LazyWrites> writes;
+    collectWrites(index, writes);
+    if (!writes.empty()) { applyWrites(writes.front(), value); }
+    return value;
+}
+
+nbt::CompoundTag LazyCompoundTag::materialize() const { return materialize(collectWrites()); }
+
+nbt::CompoundTag LazyCompoundTag::materialize(std::vector<LazyWrites> writes) const {
+    auto  value  = mDocument->materialize(nbt::Tag::Type::Compound, mBegin, mEnd);
+    auto& result = value.as<nbt::CompoundTag>();
+    applyWrites(writes, result);
+    return std::move(result);
+}
+
+std::vector<LazyWrites> LazyCompoundTag::collectWrites() const {
+    std::vector<LazyWrites> writes;
+    for (auto const& [index, array] : mArrays) { collectWrites(index, writes); }
+    for (auto const& [index, compound] : mCompounds) { collectWrites(index, writes); }
+    for (auto const& [index, list] : mLists) { collectWrites(index, writes); }
+    return writes;
+}
+
+void LazyCompoundTag::collectWrites(std::size_t index, std::vector<LazyWrites>& writes) const {
+    LazyWrites write;
+    write.mKey   = mEntries[index].mKey;
+    write.mIndex = index;
+    // Arrays still viewing the content are unchanged
+    if (auto array = mArrays.find(index); array != mArrays.end()) {
+        if (!array->second->isView()) { write.mArray = array->second->materialize(); }
+    } else if (auto compound = mCompounds.find(index); compound != mCompounds.end()) {
+        write.mChildren = compound->second->collectWrites();
+    } else if (auto list = mLists.find(index); list != mLists.end()) {
+        write.mChildren = list->second->collectWrites();
+    }
+    if (write.mArray || !write.mChildren.empty()) { writes.push_back(std::move(write)); }
+}
+
+LazyListTag::LazyListTag(std::shared_ptr<LazyDocument const> document, std::size_t begin, std::size_t end)
+: mDocument(std::move(document)),
+  mBegin(begin),
+  mEnd(end) {
+    NbtReader reader(mDocument->content(), mDocument->encoding(), begin);
+    mElementType = reader.readType();
+    mSize        = reader.readLength();
+    mDataBegin   = reader.position();
+    mFixedSize   = reader.fixedSizeOf(mElementType);
+    if (mFixedSize == 0 && mElementType != nbt::Tag::Type::End) {
+        mOffsets.reserve(mSize + 1);
+        for (std::size_t i = 0; i < mSize; ++i) {
+            mOffsets.push_back(reader.position());
+            reader.skipPayload(mElementType);
+        }
+        mOffsets.push_back(reader.position());
+    }
+}
+
+std::size_t LazyListTag::elementBegin(std::size_t index) const noexcept {
+    return mOffsets.empty() ? mDataBegin + index * mFixedSize : mOffsets[index];
+}
+
+std::size_t LazyListTag::elementEnd(std::size_t index) const noexcept {
+    return mOffsets.empty() ? mDataBegin + (index + 1) * mFixedSize : mOffsets[index + 1];
+}
+
+std::shared_ptr<LazyCompoundTag> LazyListTag::compoundAt(std::size_t index) const {
+    auto& cached = mCompounds[index];
+    if (!cached) { cached = std::make_shared<LazyCompoundTag>(mDocument, elementBegin(index)); }
+    return cached;
+}
+
+std::shared_ptr<LazyListTag> LazyListTag::listAt(std::size_t index) const {
+    auto& cached = mLists[index];
+    if (!cached) { cached = std::make_shared<LazyListTag>(mDocument, elementBegin(index), elementEnd(index)); }
+    return cached;
+}
+
+std::shared_ptr<LazyArrayTag> LazyListTag::arrayAt(std::size_t index) const {
+    auto& cached = mArrays[index];
+    if (!cached) { cached = std::make_shared<LazyArrayTag>(mDocument, mElementType, elementBegin(index)); }
+    return cached;
+}
+
+nbt::CompoundTagVariant LazyListTag::valueAt(std::size_t index) const {
+    auto                    value = mDocument->materialize(mElementType, elementBegin(index), elementEnd(index));
+    std::vector<LazyWrites> writes;
+    collectWrites(index, writes);
+    if (!writes.empty()) { applyWrites(writes.front(), value); }
+    return value;
+}
+
+nbt::ListTag LazyListTag::materialize() const { return materialize(collectWrites()); }
+
+nbt::ListTag LazyListTag::materialize(std::vector<LazyWrites> writes) const {
+    auto  value  = mDocument->materialize(nbt::Tag::Type::List, mBegin, mEnd);
+    auto& result = value.as<nbt::ListTag>();
+    applyWrites(writes, result);
+    return std::move(result);
+}
+
+std::vector<LazyWrites> LazyListTag::collectWrites() const {
+    std::vector<LazyWrites> writes;
+    for (auto const& [index, array] : mArrays) { collectWrites(index, writes); }
+    for (auto const& [index, compound] : mCompounds) { collectWrites(index, writes); }
+    for (auto const& [index, list] : mLists) { collectWrites(index, writes); }
+    return writes;
+}
+
+void LazyListTag::collectWrites(std::size_t index, std::vector<LazyWrites>& writes) const {
+    LazyWrites write;
+    write.mIndex = index;
+    if (auto array = mArrays.find(index); array != mArrays.end()) {
+        if (!array->second->isView()) { write.mArray = array->second->materialize(); }
+    } else if (auto compound = mCompounds.find(index); compound != mCompounds.end()) {
+        write.mChildren = compound->second->collectWrites();
+    } else if (auto list = mLists.find(index); list != mLists.end()) {
+        write.mChildren = list->second->collectWrites();
+    }
+    if (write.mArray || !write.mChildren.empty()) { writes.push_back(std::move(write)); }
+}
+
+LazyArrayTag::LazyArrayTag(std::shared_ptr<LazyDocument const> document, nbt::Tag::Type type, std::size_t begin)
+: mDocument(std::move(document)),
+  mType(type) {
+    NbtReader reader(mDocument->content(), mDocument->encoding(), begin);
+    mSize     = reader.readLength();
+    mItemSize = type == nbt::Tag::Type::ByteArray ? 1 : type == nbt::Tag::Type::IntArray ? 4 : 8;
+    // Bytes never need decoding, wider elements only when the file is little-endian like the host
+    if (type == nbt::Tag::Type::ByteArray
+        || (mDocument->encoding() == NbtEncoding::LittleEndian && std::endian::native == std::endian::little)) {
+        mData = reader.readBytes(mSize * mItemSize).data();
+        return;
+    }
+    mOwned.resize(mSize * mItemSize);
+    for (std::size_t i = 0; i < mSize; ++i) {
+        if (type == nbt::Tag::Type::IntArray) {
+            auto value = reader.readInt();
+            std::memcpy(mOwned.data() + i * mItemSize, &value, mItemSize);
+        } else {
+            auto value = reader.readLong();
+            std::memcpy(mOwned.data() + i * mItemSize, &value, mItemSize);
+        }
+    }
+    mData = mOwned.data();
+}
+
+char* LazyArrayTag::mutableData() {
+    if (isView()) {
+        mOwned.assign(mData, mSize * mItemSize);
+        mData = mOwned.data();
+    }
+    return mOwned.data();
+}
+
+std::unique_ptr<nbt::Tag> LazyArrayTag::materialize() const {
+    switch (mType) {
+    case nbt::Tag::Type::ByteArray: {
+        auto tag = std::make_unique<nbt::ByteArrayTag>();
+        tag->storage().resize(mSize);
+        std::memcpy(tag->storage().data(), mData, mSize);
+        return tag;
+    }
+    case nbt::Tag::Type::IntArray: {
+        auto tag = std::make_unique<nbt::IntArrayTag>();
+        tag->storage().resize(mSize);
+        std::memcpy(tag->storage().data(), mData, mSize * mItemSize);
+        return tag;
+    }
+    default: {
+        auto tag = std::make_unique<nbt::LongArrayTag>();
+        tag->storage().resize(mSize);
+        std::memcpy(tag->storage().data(), mData, mSize * mItemSize);
+        return tag;
+    }
+    }
+}
+
+namespace {
+
+template <typename Node>
+py::object lazyValueAt(Node const& node, nbt::Tag::Type type, std::size_t index) {
+    switch (type) {
+    case nbt::Tag::Type::Compound:
+        return py::cast(node.compoundAt(index));
+    case nbt::Tag::Type::List:
+        return py::cast(node.listAt(index));
+    case nbt::Tag::Type::ByteArray:
+    case nbt::Tag::Type::IntArray:
+    case nbt::Tag::Type::LongArray:
+        return py::cast(node.arrayAt(index));
+    default:
+        return py::cast(node.valueAt(index));
+    }
+}
+
+template <typename T>
+py::object lazyArrayItem(LazyArrayTag const& self, std::size_t index) {
+    if (index >= self.size()) { throw py::index_error("index out of range"); }
+    return py::cast(self.get<T>(index));
+}
+
+template <typename T>
+void setLazyArrayItem(LazyArrayTag& self, std::size_t index, py::int_ const& value) {
+    if (index >= self.size()) { throw py::index_error("index out of range"); }
+    self.set(index, static_cast<T>(to_cpp_int<T>(value, magic_enum::enum_name(self.getType()))));
+}
+
+py::object lazyValue(LazyCompoundTag const& self, std::string_view key) {
+    auto* entry = self.find(key);
+    if (!entry) { throw py::key_error(std::string(key)); }
+    return lazyValueAt(self, entry->mType, static_cast<std::size_t>(entry - self.entries().data()));
+}
+
+} // namespace
+
+void bindLazyCompoundTag(py::module& m) {
+    auto sm = m.def_submodule("lazy_compound_tag", "Read-only views of binary NBT which only build tags when they are accessed");
+
+    py::class_<LazyCompoundTag, std::shared_ptr<LazyCompoundTag>>(sm, "LazyCompoundTag")
+        .def("__getitem__", &lazyValue, py::arg("key"), "Get value by key\nCompounds, lists and arrays stay lazy, other tags are built on access\nThrow KeyError if not found")
+        .def("get", &lazyValue, py::arg("key"), "Get value by key\nCompounds, lists and arrays stay lazy, other tags are built on access\nThrow KeyError if not found")
+        .def(
+            "contains",
+            [](LazyCompoundTag const& self, std::string_view key) { return self.find(key) != nullptr; },
+            py::arg("key"),
+            "Check if key exists"
+        )
+        .def(
+            "contains",
+            [](LazyCompoundTag const& self, std::string_view key, nbt::Tag::Type type) {
+                auto* entry = self.find(key);
+                return entry && entry->mType == type;
+            },
+            py::arg("key"),
+            py::arg("type"),
+            "Check if key exists and value type is the specific type"
+        )
+        .def(
+            "get_type",
+            [](LazyCompoundTag const& self, std::string_view key) {
+                auto* entry = self.find(key);
+                if (!entry) { throw py::key_error(std::string(key)); }
+                return entry->mType;
+            },
+            py::arg("key"),
+            "Get the tag type stored at key without building it\nThrow KeyError if not found"
+        )
+        .def("size", &LazyCompoundTag::size, "Get the size of the compound")
+        .def(
+            "keys",
+            [](LazyCompoundTag const& self) {
+                py::list keys;
+                for (auto const& entry : self.entries()) { keys.append(py::str(entry.mKey.data(), entry.mKey.size())); }
+                return keys;
+            },
+            "Get list of all keys in the compound"
+        )
+        .def(
+            "items",
+            [](LazyCompoundTag const& self) {
+                py::list items;
+                for (std::size_t i = 0; i < self.size(); ++i) {
+                    auto const& entry = self.entries()[i];
+                    items.append(py::make_tuple(py::str(entry.mKey.data(), entry.mKey.size()), lazyValueAt(self, entry.mType, i)));
+                }
+                return items;
+            },
+            "Get list of (key, value) pairs in the compound"
+        )
+        .def(
+            "materialize",
+            [](LazyCompoundTag const& self) {
+                // Written arrays are copied before releasing the GIL, other threads may keep writing through the views
+                auto                   writes = self.collectWrites();
+                py::gil_scoped_release release;
+                return self.materialize(std::move(writes));
+            },
+            "Build the whole subtree as a CompoundTag"
+        )
+        .def(
+            "to_snbt",
+            [](LazyCompoundTag const& self, nbt::SnbtFormat format, uint8_t indent, nbt::SnbtNumberFormat number_format) {
+                return self.materialize().toSnbt(format, indent, number_format);
+            },
+            py::arg("format")        = nbt::SnbtFormat::Default,
+            py::arg("indent")        = 4,
+            py::arg("number_format") = nbt::SnbtNumberFormat::Default,
+            "Convert tag to SNBT string"
+        )
+
+        .def("__contains__", [](LazyCompoundTag const& self, std::string_view key) { return self.find(key) != nullptr; }, py::arg("key"))
+        .def("__len__", &LazyCompoundTag::size, "Get number of key-value pairs")
+        .def(
+            "__iter__",
+            [](LazyCompoundTag const& self) {
+                py::list keys;
+                for (auto const& entry : self.entries()) { keys.append(py::str(entry.mKey.data(), entry.mKey.size())); }
+                return py::iter(keys);
+            },
+            "Iterate over keys in the compound"
+        )
+        .def(
+            "__str__",
+            [](LazyCompoundTag const& self) { return self.materialize().toSnbt(nbt::SnbtFormat::Minimize); },
+            "String representation (SNBT minimized format)"
+        )
+        .def(
+            "__repr__",
+            [](LazyCompoundTag const& self) { return std::format("<rapidnbt.LazyCompoundTag(size={0}) object at 0x{1:0{2}X}>", self.size(), ADDRESS); },
+            "Official string representation"
+        );
+
+    py::class_<LazyListTag, std::shared_ptr<LazyListTag>>(sm, "LazyListTag")
+        .def(
+            "__getitem__",
+            [](LazyListTag const& self, std::size_t index) {
+                if (index >= self.size()) { throw py::index_error("Index out of range"); }
+                return lazyValueAt(self, self.getElementType(), index);
+            },
+            py::arg("index"),
+            "Get element at specified index\nCompounds, lists and arrays stay lazy, other tags are built on access"
+        )
+        .def("size", &LazyListTag::size, "Get number of elements in the list")
+        .def("get_element_type", &LazyListTag::getElementType, "Get the type of elements in this list")
+        .def(
+            "to_list",
+            [](LazyListTag const& self) {
+                py::list result;
+                for (std::size_t i = 0; i < self.size(); ++i) { result.append(lazyValueAt(self, self.getElementType(), i)); }
+                return result;
+            },
+            "Get the elements as a list"
+        )
+        .def(
+            "materialize",
+            [](LazyListTag const& self) {
+                auto                   writes = self.collectWrites();
+                py::gil_scoped_release release;
+                return self.materialize(std::move(writes));
+            },
+            "Build the whole list as a ListTag"
+        )
+
+        .def("__len__", &LazyListTag::size, "Get number of elements in the list")
+        .def(
+            "__str__",
+            [](LazyListTag const& self) { return self.materialize().toSnbt(nbt::SnbtFormat::Minimize); },
+            "String representation (SNBT minimized format)"
+        )
+        .def(
+            "__repr__",
+            [](LazyListTag const& self) { return std::format("<rapidnbt.LazyListTag(size={0}) object at 0x{1:0{2}X}>", self.size(), ADDRESS); },
+            "Official string representation"
+        );
+
+    py::class_<LazyArrayTag, std::shared_ptr<LazyArrayTag>>(sm, "LazyArrayTag", py::buffer_protocol())
+        .def_buffer([](LazyArrayTag& self) {
+            auto format = self.getType() == nbt::Tag::Type::ByteArray ? py::format_descriptor<uint8_t>::format()
+                        : self.getType() == nbt::Tag::Type::IntArray  ? py::format_descriptor<int32_t>::format()
+                                                                       : py::format_descriptor<int64_t>::format();
+            return py::buffer_info(
+                const_cast<char*>(self.data()),
+                static_cast<py::ssize_t>(self.itemSize()),
+                format,
+                1,
+                {static_cast<py::ssize_t>(self.size())},
+                {static_cast<py::ssize_t>(self.itemSize())},
+                self.isView()
+            );
+        })
+        .def("get_type", &LazyArrayTag::getType, "Get the NBT type ID of the array")
+        .def("size", &LazyArrayTag::size, "Get number of elements in the array")
+        .def("is_view", &LazyArrayTag::isView, "Check if the array still points into the loaded content\nThe buffer is read-only while it is a view")
+        .def(
+            "__getitem__",
+            [](LazyArrayTag const& self, std::size_t index) {
+                switch (self.getType()) {
+                case nbt::Tag::Type::ByteArray:
+                    return lazyArrayItem<uint8_t>(self, index);
+                case nbt::Tag::Type::IntArray:
+                    return lazyArrayItem<int32_t>(self, index);
+                default:
+                    return lazyArrayItem<int64_t>(self, index);
+                }
+            },
+            py::arg("index"),
+            "Get element at index"
+        )
+        .def(
+            "__setitem__",
+            [](LazyArrayTag& self, std::size_t index, py::int_ const& value) {
+                switch (self.getType()) {
+                case nbt::Tag::Type::ByteArray:
+                    return setLazyArrayItem<uint8_t>(self, index, value);
+                case nbt::Tag::Type::IntArray:
+                    return setLazyArrayItem<int32_t>(self, index, value);
+                default:
+                    return setLazyArrayItem<int64_t>(self, index, value);
+                }
+            },
+            py::arg("index"),
+            py::arg("value"),
+            "Set element at index\nThe view is copied into owned storage on the first write, the write is kept by the parent and included in its materialize()"
+        )
+        .def(
+            "to_list",
+            [](LazyArrayTag const& self) {
+                py::list result;
+                for (std::size_t i = 0; i < self.size(); ++i) {
+                    switch (self.getType()) {
+                    case nbt::Tag::Type::ByteArray:
+                        result.append(self.get<uint8_t>(i));
+                        break;
+                    case nbt::Tag::Type::IntArray:
+                        result.append(self.get<int32_t>(i));
+                        break;
+                    default:
+                        result.append(self.get<int64_t>(i));
+                    }
+                }
+                return result;
+            },
+            "Get the elements as a list"
+        )
+        .def("materialize", &LazyArrayTag::materialize, "Copy the array into a ByteArrayTag, IntArrayTag or LongArrayTag")
+
+        .def("__len__", &LazyArrayTag::size, "Get number of elements in the array")
+        .def(
+            "__str__",
+            [](LazyArrayTag const& self) { return self.materialize()->toSnbt(nbt::SnbtFormat::Minimize); },
+            "String representation (SNBT minimized format)"
+        )
+        .def(
+            "__repr__",
+            [](LazyArrayTag const& self) {
+                return std::format(
+                    "<rapidnbt.LazyArrayTag(type={0}, size={1}, view={2}) object at 0x{3:0{4}X}>",
+                    ENUM(self.getType()),
+                    self.size(),
+                    self.isView(),
+                    ADDRESS
+                );
+            },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
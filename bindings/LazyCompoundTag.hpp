@@ -0,0 +1,174 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "ContentBuffer.hpp"
+#include "NbtReader.hpp"
+#include <cstring>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace rapidnbt {
+
+// Decompressed binary NBT shared by every lazy node built from it
+class LazyDocument {
+public:
+    LazyDocument(std::shared_ptr<ContentBuffer> buffer, nbt::NbtFileFormat format);
+
+    std::string_view content() const noexcept { return mBuffer->view(); }
+    NbtEncoding      encoding() const noexcept { return mEncoding; }
+
+    // Build the tag whose payload is stored in [begin, end)
+    nbt::CompoundTagVariant materialize(nbt::Tag::Type type, std::size_t begin, std::size_t end) const;
+
+private:
+    std::shared_ptr<ContentBuffer> mBuffer;
+    nbt::NbtFileFormat             mPayloadFormat;
+    NbtEncoding                    mEncoding;
+};
+
+struct LazyEntry {
+    std::string_view mKey;
+    nbt::Tag::Type   mType;
+    std::size_t      mBegin;
+    std::size_t      mEnd;
+};
+
+// Arrays written through the cached views below a lazy node, copied out with the GIL held
+// so the node can be materialized without it while other threads keep using the views
+struct LazyWrites {
+    std::string_view          mKey;      // child key when the parent is a compound
+    std::size_t               mIndex{};  // child index when the parent is a list
+    std::unique_ptr<nbt::Tag> mArray;    // written array, null for a compound or list child
+    std::vector<LazyWrites>   mChildren; // writes below a compound or list child
+};
+
+class LazyListTag;
+class LazyArrayTag;
+
+// Read-only view of a CompoundTag which only records where its children are stored
+class LazyCompoundTag {
+public:
+    LazyCompoundTag(std::shared_ptr<LazyDocument const> document, std::size_t begin);
+
+    static std::shared_ptr<LazyCompoundTag>
+    load(std::shared_ptr<ContentBuffer> buffer, std::optional<nbt::NbtFileFormat> format, bool strictMatchSize);
+
+    std::size_t                   size() const noexcept { return mEntries.size(); }
+    std::size_t                   end() const noexcept { return mEnd; }
+    std::vector<LazyEntry> const& entries() const noexcept { return mEntries; }
+    LazyEntry const*              find(std::string_view key) const;
+
+    std::shared_ptr<LazyCompoundTag> compoundAt(std::size_t index) const;
+    std::shared_ptr<LazyListTag>     listAt(std::size_t index) const;
+    std::shared_ptr<LazyArrayTag>    arrayAt(std::size_t index) const;
+    nbt::CompoundTagVariant          valueAt(std::size_t index) const;
+    nbt::CompoundTag                 materialize() const;
+
+    // Reads the view caches, the GIL must be held
+    std::vector<LazyWrites> collectWrites() const;
+    // Only reads the document, may run without the GIL
+    nbt::CompoundTag materialize(std::vector<LazyWrites> writes) const;
+
+    std::shared_ptr<LazyDocument const> const& document() const noexcept { return mDocument; }
+
+private:
+    void collectWrites(std::size_t index, std::vector<LazyWrites>& writes) const;
+
+    std::shared_ptr<LazyDocument const>                                       mDocument;
+    std::size_t                                                               mBegin;
+    std::size_t                                                               mEnd;
+    std::vector<LazyEntry>                                                    mEntries;
+    std::unordered_map<std::string_view, std::size_t>                         mIndex;
+    mutable std::unordered_map<std::size_t, std::shared_ptr<LazyCompoundTag>> mCompounds;
+    mutable std::unordered_map<std::size_t, std::shared_ptr<LazyListTag>>     mLists;
+    mutable std::unordered_map<std::size_t, std::shared_ptr<LazyArrayTag>>    mArrays;
+};
+
+// Read-only view of a ListTag, element offsets are only recorded for variable sized elements
+class LazyListTag {
+public:
+    LazyListTag(std::shared_ptr<LazyDocument const> document, std::size_t begin, std::size_t end);
+
+    std::size_t    size() const noexcept { return mSize; }
+    nbt::Tag::Type getElementType() const noexcept { return mElementType; }
+
+    std::shared_ptr<LazyCompoundTag> compoundAt(std::size_t index) const;
+    std::shared_ptr<LazyListTag>     listAt(std::size_t index) const;
+    std::shared_ptr<LazyArrayTag>    arrayAt(std::size_t index) const;
+    nbt::CompoundTagVariant          valueAt(std::size_t index) const;
+    nbt::ListTag                     materialize() const;
+
+    // Reads the view caches, the GIL must be held
+    std::vector<LazyWrites> collectWrites() const;
+    // Only reads the document, may run without the GIL
+    nbt::ListTag materialize(std::vector<LazyWrites> writes) const;
+
+    std::shared_ptr<LazyDocument const> const& document() const noexcept { return mDocument; }
+
+private:
+    std::size_t elementBegin(std::size_t index) const noexcept;
+    std::size_t elementEnd(std::size_t index) const noexcept;
+    void        collectWrites(std::size_t index, std::vector<LazyWrites>& writes) const;
+
+    std::shared_ptr<LazyDocument const>                                      mDocument;
+    std::size_t                                                              mBegin;
+    std::size_t                                                              mEnd;
+    std::size_t                                                              mDataBegin;
+    nbt::Tag::Type                                                           mElementType;
+    std::size_t                                                              mSize;
+    std::size_t                                                              mFixedSize;
+    std::vector<std::size_t>                                                 mOffsets;
+    mutable std::unordered_map<std::size_t, std::shared_ptr<LazyCompoundTag>> mCompounds;
+    mutable std::unordered_map<std::size_t, std::shared_ptr<LazyListTag>>     mLists;
+    mutable std::unordered_map<std::size_t, std::shared_ptr<LazyArrayTag>>    mArrays;
+};
+
+// Byte, int or long array payload inside a LazyDocument
+// Payloads stored in host byte order are viewed in place, the view is copied into owned storage on first write
+// Parents cache their array views, so writes stay visible through the parent and are copied into its materialize()
+// Reading or writing the array requires the GIL, mutableData() may reallocate the owned storage
+class LazyArrayTag {
+public:
+    LazyArrayTag(std::shared_ptr<LazyDocument const> document, nbt::Tag::Type type, std::size_t begin);
+
+    LazyArrayTag(LazyArrayTag const&)            = delete;
+    LazyArrayTag& operator=(LazyArrayTag const&) = delete;
+
+    nbt::Tag::Type getType() const noexcept { return mType; }
+    std::size_t    size() const noexcept { return mSize; }
+    std::size_t    itemSize() const noexcept { return mItemSize; }
+    bool           isView() const noexcept { return mData != mOwned.data(); }
+
+    const char* data() const noexcept { return mData; }
+    char*       mutableData();
+
+    std::unique_ptr<nbt::Tag> materialize() const;
+
+    template <typename T>
+    T get(std::size_t index) const noexcept {
+        T value;
+        std::memcpy(&value, mData + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void set(std::size_t index, T value) {
+        std::memcpy(mutableData() + index * sizeof(T), &value, sizeof(T));
+    }
+
+private:
+    std::shared_ptr<LazyDocument const> mDocument;
+    nbt::Tag::Type                      mType;
+    std::size_t                         mSize;
+    std::size_t                         mItemSize;
+    std::string                         mOwned;
+    const char*                         mData;
+};
+
+} // namespace rapidnbt
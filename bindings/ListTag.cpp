@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "NativeModule.hpp"
+#include "PythonConversion.hpp"
 
 namespace rapidnbt {
 
@@ -27,7 +28,13 @@ void bindListTag(py::module& m) {
 
         .def("get_type", &nbt::ListTag::getType, "Get the NBT type ID (List)")
         .def("equals", &nbt::ListTag::equals, py::arg("other"), "Check if this tag equals another tag (same elements in same order)")
-        .def("copy", &nbt::ListTag::copy, "Create a deep copy of this tag")
+        .def(
+            "copy",
+            &nbt::ListTag::copy,
+            "Create a deep copy of this tag\nThe whole tree is copied, O(n) in the number of tags, move=True on set() or append() and take() "
+            "transfer a tag without copying"
+        )
+        .def("hash", &nbt::ListTag::hash, "Compute hash value of this tag\nThe whole list is hashed on every call, O(n) in the number of tags")
 
         .def(
             "write",
@@ -44,30 +51,39 @@ void bindListTag(py::module& m) {
 
         .def(
             "append",
-            [](nbt::ListTag& self, py::object const& element, bool checkType) {
-                auto tag = makeNativeTag(element);
-                if (checkType) {
-                    auto type = self.getElementType();
-                    if (type == tag->getType() || type == nbt::Tag::Type::End) {
-                        self.push_back(std::move(tag));
-                    } else {
-                        throw py::value_error(
-                            std::format(
-                                "New tag type must be same as the original element type in the ListTag[{1}], "
-                                "received type: {0}, expect types can be converted to {1}Tag",
-                                py_type_name(element),
-                                ENUM(type)
-                            )
-                        );
-                    }
+            [](py::object const& obj, py::object const& element, bool checkType, bool move) {
+                auto& self = obj.cast<nbt::ListTag&>();
+                // A tag to move is type checked before its contents are taken, so a rejected tag is left untouched
+                std::unique_ptr<nbt::Tag> tag;
+                nbt::Tag::Type            tagType;
+                if (move && py::isinstance<nbt::CompoundTagVariant>(element)) {
+                    tagType = element.cast<nbt::CompoundTagVariant const&>().getType();
+                } else if (move && py::isinstance<nbt::Tag>(element)) {
+                    tagType = element.cast<nbt::Tag const&>().getType();
                 } else {
-                    self.push_back(std::move(tag));
+                    tag     = makeNativeTag(element);
+                    tagType = tag->getType();
+                }
+                auto type = self.getElementType();
+                if (checkType && type != tagType && type != nbt::Tag::Type::End) {
+                    throw py::value_error(
+                        std::format(
+                            "New tag type must be same as the original element type in the ListTag[{1}], "
+                            "received type: {0}, expect types can be converted to {1}Tag",
+                            py_type_name(element),
+                            ENUM(type)
+                        )
+                    );
                 }
+                self.push_back(tag ? std::move(tag) : takeNativeTag(element, obj));
             },
             py::arg("element"),
             py::arg("check_type") = true,
-            "Append a Tag element if self is ListTag\nThrow TypeError if wrong type and check_type is True\n\nArgs:\n    value (Any): value append to "
-            "ListTag\n    check_type (bool): check value type is same as the type that ListTag holds"
+            py::arg("move")       = false,
+            "Append a Tag element if self is ListTag\nThrow TypeError if wrong type and check_type is True\nThrow ValueError if a tag is moved into "
+            "itself or one of its descendants\n\nArgs:\n    value (Any): value append to "
+            "ListTag\n    check_type (bool): check value type is same as the type that ListTag holds\n    move (bool): Move the contents of a tag instead "
+            "of copying them, leaving it an empty tag of the same type (default: False)"
         )
 
         .def(
@@ -84,7 +100,7 @@ void bindListTag(py::module& m) {
             "__setitem__",
             [](nbt::ListTag& self, size_t index, py::object const& element) {
                 if (index >= self.size()) { throw py::index_error("Index out of range"); }
-                self[index] = *makeNativeTag(element);
+                self[index] = makeNativeTag(element);
             },
             py::arg("index"),
             py::arg("element"),
@@ -99,6 +115,19 @@ void bindListTag(py::module& m) {
             "Get the type of elements in this list (returns nbt.Type enum)"
         )
         .def("reserve", &nbt::ListTag::reserve, py::arg("size"), "Preallocate memory for future additions")
+        .def(
+            "take",
+            [](nbt::ListTag& self, size_t index) {
+                if (index >= self.size()) { throw py::index_error("Index out of range"); }
+                auto tag = takeTag(self[index]);
+                self.remove(index);
+                return tag;
+            },
+            py::arg("index"),
+            "Remove the element at index and return it without copying it\nReferences obtained earlier to or into the removed element stay valid and "
+            "refer to the returned tag, an earlier self[index] is left holding an empty tag\nLater elements move down one index, so references to "
+            "them refer to the element now at their index, as with pop()\nThrow IndexError if out of range\n\nReturns:\n    Tag"
+        )
         .def(
             "pop",
             [](nbt::ListTag& self, size_t index) { return self.remove(index); },
@@ -155,6 +184,19 @@ void bindListTag(py::module& m) {
                 return result;
             }
         )
+        .def(
+            "to_python",
+            [](nbt::ListTag const& self, ArrayFormat arrays, bool typed_numbers, bool intern_keys) {
+                return makePythonObject(self, {arrays, typed_numbers, intern_keys});
+            },
+            py::arg("arrays")        = ArrayFormat::Bytes,
+            py::arg("typed_numbers") = false,
+            py::arg("intern_keys")   = false,
+            "Convert to plain Python objects (dict, list, int, float, str, bytes) in one native pass\n\nArgs:\n    arrays (ArrayFormat): How byte, int and long "
+            "arrays are returned (default: BYTES, bytes for byte arrays and array.array otherwise)\n    typed_numbers (bool): Return numbers as ctypes "
+            "instances (c_uint8, c_int16, c_int32, c_int64, c_float, c_double) so the tag types survive ListTag(list) (default: False)\n    intern_keys (bool): Intern compound keys with sys.intern so they are shared across "
+            "documents, repeated keys always share one str within a call (default: False)\n\nReturns:\n    list"
+        )
 
         .def_property(
             "value",
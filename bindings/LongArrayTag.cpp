@@ -5,6 +5,7 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "BufferExport.hpp"
 #include "NativeModule.hpp"
 
 namespace rapidnbt {
@@ -12,8 +13,18 @@ namespace rapidnbt {
 void bindLongArrayTag(py::module& m) {
     auto sm = m.def_submodule("long_array_tag", "A tag contains a long array (int64 array)");
 
-    py::class_<nbt::LongArrayTag, nbt::Tag>(sm, "LongArrayTag")
+    py::class_<nbt::LongArrayTag, nbt::Tag>(sm, "LongArrayTag", py::buffer_protocol())
+        .def_buffer([](nbt::LongArrayTag& self) { return exportBuffer(self, self.storage()); })
         .def(py::init<>(), "Construct an empty LongArrayTag")
+        .def(
+            py::init([](py::buffer buf) {
+                auto result = std::make_unique<nbt::LongArrayTag>();
+                assign_from_buffer(result->storage(), buf);
+                return result;
+            }),
+            py::arg("buf"),
+            "Construct from a buffer of 8-byte integers (e.g. numpy array)\nContiguous native integers of the same width are copied with a single memcpy"
+        )
         .def(py::init<std::vector<int64_t> const&>(), py::arg("values"), "Construct from a list of integers\nExample:\n    LongArrayTag([1, 2, 3]))")
 
         .def("get_type", &nbt::LongArrayTag::getType, "Get the NBT type ID (int array)")
@@ -29,7 +40,10 @@ void bindLongArrayTag(py::module& m) {
         )
         .def(
             "load",
-            [](nbt::LongArrayTag& self, bstream::ReadOnlyBinaryStream& stream) { self.load(stream); },
+            [](nbt::LongArrayTag& self, bstream::ReadOnlyBinaryStream& stream) {
+                ensureResizable(self);
+                self.load(stream);
+            },
             py::arg("stream"),
             "Load int array from a binary stream"
         )
@@ -42,11 +56,21 @@ void bindLongArrayTag(py::module& m) {
         )
         .def(
             "reserve",
-            &nbt::LongArrayTag::reserve,
+            [](nbt::LongArrayTag& self, std::size_t capacity) {
+                ensureResizable(self);
+                self.reserve(capacity);
+            },
             py::arg("capacity"),
             "Reserve storage capacity for the array\n\nArguments:\n    capacity: Minimum capacity to reserv))"
         )
-        .def("clear", &nbt::LongArrayTag::clear, "Remove all elements from the array")
+        .def(
+            "clear",
+            [](nbt::LongArrayTag& self) {
+                ensureResizable(self);
+                self.clear();
+            },
+            "Remove all elements from the array"
+        )
         .def(
             "__getitem__",
             [](nbt::LongArrayTag const& self, size_t index) {
@@ -66,25 +90,51 @@ void bindLongArrayTag(py::module& m) {
             py::arg("value"),
             "Set element at index"
         )
-        .def("append", &nbt::LongArrayTag::push_back, py::arg("value"), "Append an integer to the end of the array")
+        .def(
+            "append",
+            [](nbt::LongArrayTag& self, int64_t value) {
+                ensureResizable(self);
+                self.push_back(value);
+            },
+            py::arg("value"),
+            "Append an integer to the end of the array"
+        )
         .def(
             "pop",
-            py::overload_cast<size_t>(&nbt::LongArrayTag::remove),
+            [](nbt::LongArrayTag& self, size_t index) {
+                ensureResizable(self);
+                return self.remove(index);
+            },
             py::arg("index"),
             "Remove element at specified index"
             "Returns True if successful, False if index out of range"
         )
         .def(
             "pop",
-            py::overload_cast<size_t, size_t>(&nbt::LongArrayTag::remove),
+            [](nbt::LongArrayTag& self, size_t start, size_t end) {
+                ensureResizable(self);
+                return self.remove(start, end);
+            },
             py::arg("start_index"),
             py::arg("end_index"),
             "Remove elements in the range [start_index, end_index)\nArguments:\n    start_index: First index to remove (inclusive)\n    end_index: End index "
             "(exclusive)\nReturns:\nTrue if successful, False if indices out of range"
         )
+        .def(
+            "assign",
+            [](nbt::LongArrayTag& self, py::buffer buf) -> nbt::LongArrayTag& {
+                ensureResizable(self);
+                assign_from_buffer(self.storage(), buf);
+                return self;
+            },
+            py::arg("buf"),
+            py::return_value_policy::reference_internal,
+            "Assign new values from a buffer of 8-byte integers (e.g. numpy array)\nContiguous native integers of the same width are copied with a single memcpy\nReturns the modified array"
+        )
         .def(
             "assign",
             [](nbt::LongArrayTag& self, std::vector<int64_t> const& values) {
+                ensureResizable(self);
                 self = values;
                 return self;
             },
@@ -95,7 +145,10 @@ void bindLongArrayTag(py::module& m) {
         .def_property(
             "value",
             [](nbt::LongArrayTag& self) -> std::vector<int64_t> { return self.storage(); },
-            [](nbt::LongArrayTag& self, std::vector<int64_t> const& value) { self.storage() = value; },
+            [](nbt::LongArrayTag& self, std::vector<int64_t> const& value) {
+                ensureResizable(self);
+                self.storage() = value;
+            },
             "Access the long array as a list of integers"
         )
 
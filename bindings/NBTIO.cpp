@@ -5,15 +5,165 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "AsyncWriter.hpp"
+#include "Compression.hpp"
+#include "FrozenCompoundTag.hpp"
+#include "LazyCompoundTag.hpp"
 #include "NativeModule.hpp"
+#include "NbtEventReader.hpp"
+#include "NbtFile.hpp"
+#include "NbtProjection.hpp"
+#include "ParallelFor.hpp"
+#include <fstream>
 
 namespace rapidnbt {
 
+namespace {
+
+std::string serializeBinary(
+    nbt::CompoundTag const&  nbt,
+    nbt::NbtFileFormat       format,
+    nbt::NbtCompressionType  compressionType,
+    nbt::NbtCompressionLevel compressionLevel,
+    std::optional<int>       headerVersion,
+    std::size_t              compressionThreads
+) {
+    if (compressionThreads == 1 || compressionType == nbt::NbtCompressionType::None) {
+        return nbt::io::saveAsBinary(nbt, format, compressionType, compressionLevel, headerVersion);
+    }
+    auto content = nbt::io::saveAsBinary(nbt, format, nbt::NbtCompressionType::None, compressionLevel, headerVersion);
+    return compressParallel(content, compressionType, compressionLevel, compressionThreads);
+}
+
+// Inflate with the selected backend before handing the payload to the parser
+std::optional<nbt::CompoundTag> parseContent(std::string_view content, std::optional<nbt::NbtFileFormat> format, bool strictMatchSize) {
+    if (detectCompression(content) != nbt::NbtCompressionType::None) {
+        auto inflated = decompress(content);
+        if (!inflated) { return std::nullopt; }
+        return nbt::io::parseFromContent(inflated->view(), format, strictMatchSize);
+    }
+    return nbt::io::parseFromContent(content, format, strictMatchSize);
+}
+
+std::optional<nbt::CompoundTag>
+parseFile(std::filesystem::path const& path, std::optional<nbt::NbtFileFormat> format, bool fileMemoryMap, bool strictMatchSize) {
+    auto buffer = ContentBuffer::fromFile(path, fileMemoryMap);
+    if (!buffer) { return std::nullopt; }
+    return parseContent(buffer->view(), format, strictMatchSize);
+}
+
+// Compile include paths before the GIL is released, malformed paths raise NbtPathError
+std::optional<NbtProjection> makeProjection(std::optional<std::vector<std::string>> const& include, bool lazy, bool frozen) {
+    if (lazy && frozen) { throw py::value_error("frozen can not be combined with lazy"); }
+    if (!include) { return std::nullopt; }
+    if (lazy) { throw py::value_error("include can not be combined with lazy"); }
+    std::vector<NbtPath> paths;
+    paths.reserve(include->size());
+    for (auto const& path : *include) { paths.push_back(NbtPath::parse(path)); }
+    return NbtProjection(paths);
+}
+
+// Freeze a parsed tree, dropping the mutable one, without the GIL
+py::object castParsed(std::optional<nbt::CompoundTag> result, bool frozen) {
+    if (!frozen || !result) { return py::cast(std::move(result)); }
+    std::optional<FrozenCompoundTag> frozenResult;
+    {
+        py::gil_scoped_release release;
+        frozenResult = FrozenCompoundTag::freeze(*result);
+        result.reset();
+    }
+    return py::cast(std::move(frozenResult));
+}
+
+// Value of a Base64 digit or -1, the URL-safe alphabet is accepted unless strict
+int base64Digit(char ch, bool strict) {
+    if (ch >= 'A' && ch <= 'Z') { return ch - 'A'; }
+    if (ch >= 'a' && ch <= 'z') { return ch - 'a' + 26; }
+    if (ch >= '0' && ch <= '9') { return ch - '0' + 52; }
+    if (ch == '+' || (!strict && ch == '-')) { return 62; }
+    if (ch == '/' || (!strict && ch == '_')) { return 63; }
+    return -1;
+}
+
+// Lenient decoding: either alphabet, whitespace is skipped, padding is optional and anything after it is ignored
+std::optional<std::string> fromBase64(std::string_view content) {
+    std::string result;
+    result.reserve(content.size() / 4 * 3);
+    uint32_t value = 0;
+    int      bits  = 0;
+    for (auto ch : content) {
+        if (ch == '=') { break; }
+        if (ch == '\n' || ch == '\r' || ch == ' ' || ch == '\t') { continue; }
+        auto digit = base64Digit(ch, false);
+        if (digit < 0) { return std::nullopt; }
+        value = (value << 6 | static_cast<uint32_t>(digit)) & 0xFFFFFF;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            result.push_back(static_cast<char>(value >> bits & 0xFF));
+        }
+    }
+    return result;
+}
+
+// Strict RFC 4648 decoding: standard alphabet, padded to a multiple of four characters and nothing after the padding
+std::optional<std::string> fromBase64Strict(std::string_view content) {
+    if (content.size() % 4 != 0) { return std::nullopt; }
+    std::size_t padding = content.ends_with("==") ? 2 : content.ends_with('=') ? 1 : 0;
+    std::string result;
+    result.reserve(content.size() / 4 * 3);
+    uint32_t value = 0;
+    for (std::size_t i = 0; i < content.size() - padding; ++i) {
+        auto digit = base64Digit(content[i], true);
+        if (digit < 0) { return std::nullopt; }
+        value = value << 6 | static_cast<uint32_t>(digit);
+        if (i % 4 == 3) {
+            result.push_back(static_cast<char>(value >> 16 & 0xFF));
+            result.push_back(static_cast<char>(value >> 8 & 0xFF));
+            result.push_back(static_cast<char>(value & 0xFF));
+            value = 0;
+        }
+    }
+    // The bits below the last encoded byte must be zero, otherwise the input is not a canonical encoding
+    if (padding == 2) {
+        if (value & 0xF) { return std::nullopt; }
+        result.push_back(static_cast<char>(value >> 4 & 0xFF));
+    } else if (padding == 1) {
+        if (value & 0x3) { return std::nullopt; }
+        result.push_back(static_cast<char>(value >> 10 & 0xFF));
+        result.push_back(static_cast<char>(value >> 2 & 0xFF));
+    }
+    return result;
+}
+
+std::string toBase64(std::string_view content) {
+    constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string                result;
+    result.reserve((content.size() + 2) / 3 * 4);
+    for (std::size_t i = 0; i < content.size(); i += 3) {
+        auto remaining = content.size() - i;
+        auto value     = static_cast<uint32_t>(static_cast<uint8_t>(content[i])) << 16;
+        if (remaining > 1) { value |= static_cast<uint32_t>(static_cast<uint8_t>(content[i + 1])) << 8; }
+        if (remaining > 2) { value |= static_cast<uint8_t>(content[i + 2]); }
+        result.push_back(alphabet[value >> 18 & 0x3F]);
+        result.push_back(alphabet[value >> 12 & 0x3F]);
+        result.push_back(remaining > 1 ? alphabet[value >> 6 & 0x3F] : '=');
+        result.push_back(remaining > 2 ? alphabet[value & 0x3F] : '=');
+    }
+    return result;
+}
+
+} // namespace
+
 void bindNbtIO(py::module& m) {
     m.def_submodule("nbtio")
         .def(
             "detect_content_format",
-            [](py::buffer buffer, bool strict_match_size) { return nbt::io::detectContentFormat(to_cpp_stringview(buffer), strict_match_size); },
+            [](py::buffer buffer, bool strict_match_size) {
+                auto                     content = to_cpp_string(buffer);
+                py::gil_scoped_release release;
+                return nbt::io::detectContentFormat(content, strict_match_size);
+            },
             py::arg("content"),
             py::arg("strict_match_size") = true,
             "Detect NBT format from binary content\nArgs:\n    content (bytes): Binary content to analyzeReturns:\n    NbtFileFormat or None if format cannot "
@@ -23,6 +173,7 @@ void bindNbtIO(py::module& m) {
         .def(
             "detect_file_format",
             &nbt::io::detectFileFormat,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("path"),
             py::arg("file_memory_map")   = false,
             py::arg("strict_match_size") = true,
@@ -32,13 +183,16 @@ void bindNbtIO(py::module& m) {
         )
         .def(
             "detect_content_compression_type",
-            [](py::buffer buffer) -> nbt::NbtCompressionType { return nbt::io::detectContentCompressionType(to_cpp_stringview(buffer)); },
+            [](py::buffer buffer) -> nbt::NbtCompressionType {
+                return detectCompression(to_cpp_stringview(buffer));
+            },
             py::arg("content"),
             "Detect NBT compression type from binary content\nArgs:\n    content (bytes): Binary content to analyzeReturns:\nReturns:\n    NbtCompressionType"
         )
         .def(
             "detect_file_compression_type",
             &nbt::io::detectFileCompressionType,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("path"),
             py::arg("file_memory_map") = false,
             "Detect NBT format from a file\nArgs:\n    path (os.PathLike): Path to the file\n    file_memory_map (bool): Use memory mapping for large files "
@@ -46,26 +200,199 @@ void bindNbtIO(py::module& m) {
         )
         .def(
             "loads",
-            [](py::buffer buffer, std::optional<nbt::NbtFileFormat> format, bool strict_match_size) {
-                return nbt::io::parseFromContent(to_cpp_stringview(buffer), format, strict_match_size);
+            [](py::buffer                              buffer,
+               std::optional<nbt::NbtFileFormat>       format,
+               bool                                    strict_match_size,
+               bool                                    lazy,
+               std::optional<std::vector<std::string>> include,
+               bool                                    frozen) -> py::object {
+                auto projection = makeProjection(include, lazy, frozen);
+                auto content    = to_cpp_string(buffer);
+                if (lazy) {
+                    std::shared_ptr<LazyCompoundTag> result;
+                    {
+                        py::gil_scoped_release release;
+                        result = LazyCompoundTag::load(ContentBuffer::fromString(std::move(content)), format, strict_match_size);
+                    }
+                    return result ? py::cast(result) : py::none();
+                }
+                std::optional<nbt::CompoundTag> result;
+                {
+                    py::gil_scoped_release release;
+                    result = projection ? projection->parse(content, format, strict_match_size) : parseContent(content, format, strict_match_size);
+                }
+                return castParsed(std::move(result), frozen);
             },
             py::arg("content"),
             py::arg("format")            = std::nullopt,
             py::arg("strict_match_size") = true,
+            py::arg("lazy")              = false,
+            py::arg("include")           = std::nullopt,
+            py::arg("frozen")            = false,
             "Parse CompoundTag from binary data\nArgs:\n    content (bytes): Binary NBT data\n    format (NbtFileFormat, optional): Force specific format "
-            "(autodetect if None)\n    strict_match_size (bool): Strictly match nbt content size (default: True)\nReturns:\n    CompoundTag or None if parsing "
-            "fails"
+            "(autodetect if None)\n    strict_match_size (bool): Strictly match nbt content size (default: True)\n    lazy (bool): Only index the content and "
+            "build tags on access (default: False)\n    include (list[str], optional): Only build these key paths, e.g. [\"Data.Player\"] (default: None, "
+            "everything)\n    frozen (bool): Return an immutable compact FrozenCompoundTag for read-mostly data (default: False)\nReturns:\n    CompoundTag, "
+            "LazyCompoundTag if lazy, FrozenCompoundTag if frozen or None if parsing fails"
+        )
+        .def(
+            "loads_many",
+            [](std::vector<py::buffer> const& contents, std::optional<nbt::NbtFileFormat> format, bool strict_match_size, std::size_t threads) {
+                std::vector<py::buffer_info> buffers;
+                buffers.reserve(contents.size());
+                for (auto const& content : contents) { buffers.push_back(content.request()); }
+                std::vector<std::optional<nbt::CompoundTag>> results(buffers.size());
+                {
+                    py::gil_scoped_release release;
+                    parallelFor(buffers.size(), threads, [&](std::size_t index) {
+                        try {
+                            results[index] = parseContent(to_cpp_stringview(buffers[index]), format, strict_match_size);
+                        } catch (...) {}
+                    });
+                }
+                return results;
+            },
+            py::arg("contents"),
+            py::arg("format")            = std::nullopt,
+            py::arg("strict_match_size") = true,
+            py::arg("threads")           = 0,
+            "Parse many binary NBT buffers in parallel\nArgs:\n    contents (list[bytes]): Binary NBT data\n    format (NbtFileFormat, optional): Force "
+            "specific format (autodetect if None)\n    strict_match_size (bool): Strictly match nbt content size (default: True)\n    threads (int): Number of "
+            "worker threads (default: 0, one per CPU)\nReturns:\n    list of CompoundTag (None for entries that fail to parse) in input order"
+        )
+        .def(
+            "loads_batch",
+            [](py::sequence const& contents, nbt::NbtFileFormat format, bool strict_match_size, std::size_t threads) {
+                // bytes are read in place, other buffers are requested once up front
+                // The tuple owns every item, so a list changed while the GIL is released can not free them under the workers
+                auto items = py::reinterpret_steal<py::object>(PySequence_Tuple(contents.ptr()));
+                if (!items) { throw py::error_already_set(); }
+                auto                          size  = static_cast<std::size_t>(PySequence_Fast_GET_SIZE(items.ptr()));
+                auto                          array = PySequence_Fast_ITEMS(items.ptr());
+                std::vector<std::string_view> views(size);
+                std::vector<py::buffer_info>  buffers;
+                for (std::size_t i = 0; i < size; ++i) {
+                    if (PyBytes_CheckExact(array[i])) {
+                        views[i] = {PyBytes_AS_STRING(array[i]), static_cast<std::size_t>(PyBytes_GET_SIZE(array[i]))};
+                    } else {
+                        views[i] = to_cpp_stringview(buffers.emplace_back(py::reinterpret_borrow<py::buffer>(array[i]).request()));
+                    }
+                }
+                std::vector<std::optional<nbt::CompoundTag>> results(size);
+                {
+                    py::gil_scoped_release release;
+                    parallelFor(size, threads, [&](std::size_t index) {
+                        try {
+                            results[index] = nbt::io::parseFromContent(views[index], format, strict_match_size);
+                        } catch (...) {}
+                    });
+                }
+                py::list result(size);
+                for (std::size_t i = 0; i < size; ++i) { result[i] = py::cast(std::move(results[i])); }
+                return result;
+            },
+            py::arg("contents"),
+            py::arg("format"),
+            py::arg("strict_match_size") = true,
+            py::arg("threads")           = 1,
+            "Parse many small uncompressed binary NBT values of one known format in a single call\nNo format or compression detection is done, which "
+            "suits values read from a LevelDB database\nArgs:\n    contents (list[bytes]): Binary NBT data\n    format (NbtFileFormat): Format of every "
+            "value\n    strict_match_size (bool): Strictly match nbt content size (default: True)\n    threads (int): Number of worker threads (default: 1, 0 "
+            "for one per CPU)\nReturns:\n    list of CompoundTag (None for entries that fail to parse) in input order"
         )
         .def(
             "load",
-            &nbt::io::parseFromFile,
+            [](std::filesystem::path const&            path,
+               std::optional<nbt::NbtFileFormat>       format,
+               bool                                    file_memory_map,
+               bool                                    strict_match_size,
+               bool                                    lazy,
+               std::optional<std::vector<std::string>> include,
+               bool                                    frozen) -> py::object {
+                auto projection = makeProjection(include, lazy, frozen);
+                if (lazy) {
+                    std::shared_ptr<LazyCompoundTag> result;
+                    {
+                        py::gil_scoped_release release;
+                        result = LazyCompoundTag::load(ContentBuffer::fromFile(path, file_memory_map), format, strict_match_size);
+                    }
+                    return result ? py::cast(result) : py::none();
+                }
+                std::optional<nbt::CompoundTag> result;
+                {
+                    py::gil_scoped_release release;
+                    if (projection) {
+                        if (auto buffer = ContentBuffer::fromFile(path, file_memory_map)) { result = projection->parse(buffer->view(), format, strict_match_size); }
+                    } else {
+                        result = parseFile(path, format, file_memory_map, strict_match_size);
+                    }
+                }
+                return castParsed(std::move(result), frozen);
+            },
             py::arg("path"),
             py::arg("format")            = std::nullopt,
             py::arg("file_memory_map")   = false,
             py::arg("strict_match_size") = true,
+            py::arg("lazy")              = false,
+            py::arg("include")           = std::nullopt,
+            py::arg("frozen")            = false,
             "Parse CompoundTag from a file\nArgs:\n    path (os.PathLike): Path to NBT file\n    format (NbtFileFormat, optional): Force specific format "
             "(autodetect if None)\n    file_memory_map (bool): Use memory mapping for large files (default: False)\n    strict_match_size (bool): Strictly "
-            "match nbt content size (default: True)\n\nReturns:\nCompoundTag or None if parsing fails"
+            "match nbt content size (default: True)\n    lazy (bool): Only index the file and build tags on access (default: False)\n    include (list[str], "
+            "optional): Only build these key paths, e.g. [\"Data.Player\", \"Data.LevelName\"] (default: None, everything)\n    frozen (bool): Return an "
+            "immutable compact FrozenCompoundTag for read-mostly data (default: False)\n\nReturns:\nCompoundTag, LazyCompoundTag if lazy, FrozenCompoundTag if "
+            "frozen or None if parsing fails"
+        )
+        .def(
+            "load_many",
+            [](std::vector<std::filesystem::path> const& paths,
+               std::optional<nbt::NbtFileFormat>         format,
+               bool                                      file_memory_map,
+               bool                                      strict_match_size,
+               std::size_t                               threads) {
+                std::vector<std::optional<nbt::CompoundTag>> results(paths.size());
+                {
+                    py::gil_scoped_release release;
+                    parallelFor(paths.size(), threads, [&](std::size_t index) {
+                        try {
+                            results[index] = parseFile(paths[index], format, file_memory_map, strict_match_size);
+                        } catch (...) {}
+                    });
+                }
+                return results;
+            },
+            py::arg("paths"),
+            py::arg("format")            = std::nullopt,
+            py::arg("file_memory_map")   = false,
+            py::arg("strict_match_size") = true,
+            py::arg("threads")           = 0,
+            "Read, decompress and parse many files in parallel\nArgs:\n    paths (list[os.PathLike]): Paths to NBT files\n    format (NbtFileFormat, "
+            "optional): Force specific format (autodetect if None)\n    file_memory_map (bool): Use memory mapping for large files (default: False)\n    "
+            "strict_match_size (bool): Strictly match nbt content size (default: True)\n    threads (int): Number of worker threads (default: 0, one per "
+            "CPU)\nReturns:\n    list of CompoundTag (None for entries that fail to load) in input order"
+        )
+        .def(
+            "iter_events",
+            [](py::object const& source, std::optional<nbt::NbtFileFormat> format, bool file_memory_map) -> py::object {
+                std::unique_ptr<NbtEventReader> result;
+                if (py::isinstance<py::buffer>(source)) {
+                    auto content = ContentBuffer::fromString(to_cpp_string(source.cast<py::buffer>()));
+                    py::gil_scoped_release release;
+                    result = NbtEventReader::fromContent(std::move(content), format);
+                } else {
+                    auto path = source.cast<std::filesystem::path>();
+                    py::gil_scoped_release release;
+                    result = NbtEventReader::fromFile(path, format, file_memory_map);
+                }
+                return result ? py::cast(std::move(result)) : py::none();
+            },
+            py::arg("source"),
+            py::arg("format")          = std::nullopt,
+            py::arg("file_memory_map") = false,
+            "Stream binary NBT as (event, tag_type, value) tuples without building tags\nCompressed files are inflated on the fly in constant "
+            "memory\nArgs:\n    source (os.PathLike | bytes | bytearray): Path to NBT file or binary content\n    format (NbtFileFormat, optional): Force "
+            "specific format (autodetect if None)\n    file_memory_map (bool): Use memory mapping for files (default: False)\nReturns:\n    "
+            "NbtEventReader or None if the source can not be opened"
         )
         .def(
             "dumps",
@@ -73,33 +400,94 @@ void bindNbtIO(py::module& m) {
                nbt::NbtFileFormat       format,
                nbt::NbtCompressionType  compressionType,
                nbt::NbtCompressionLevel compressionLevel,
-               std::optional<int> headerVersion) { return to_py_bytes(nbt::io::saveAsBinary(nbt, format, compressionType, compressionLevel, headerVersion)); },
+               std::optional<int>       headerVersion,
+               std::size_t              compressionThreads) {
+                std::string content;
+                {
+                    py::gil_scoped_release release;
+                    content = serializeBinary(nbt, format, compressionType, compressionLevel, headerVersion, compressionThreads);
+                }
+                return to_py_bytes(content);
+            },
             py::arg("nbt"),
-            py::arg("format")            = nbt::NbtFileFormat::LittleEndian,
-            py::arg("compression_type")  = nbt::NbtCompressionType::Gzip,
-            py::arg("compression_level") = nbt::NbtCompressionLevel::Default,
-            py::arg("header_version")    = std::nullopt,
+            py::arg("format")              = nbt::NbtFileFormat::LittleEndian,
+            py::arg("compression_type")    = nbt::NbtCompressionType::Gzip,
+            py::arg("compression_level")   = nbt::NbtCompressionLevel::Default,
+            py::arg("header_version")      = std::nullopt,
+            py::arg("compression_threads") = 1,
             "Serialize CompoundTag to binary data\nArgs:\n    nbt (CompoundTag): Tag to serialize\n    format (NbtFileFormat): Output format (default: "
             "LittleEndian)\n    compression_type (CompressionType): Compression method (default: Gzip)\n    compression_level (CompressionLevel): Compression "
-            "level (default: Default)\n    header_version (Optional[int]): NBT header storage version\nReturns:\n    bytes: Serialized binary data"
+            "level (default: Default)\n    header_version (Optional[int]): NBT header storage version\n    compression_threads (int): Compress blocks on this many "
+            "threads, 0 for one per CPU (default: 1)\nReturns:\n    bytes: Serialized binary data"
         )
         .def(
             "dump",
-            &nbt::io::saveToFile,
+            [](nbt::CompoundTag const&      nbt,
+               std::filesystem::path const& path,
+               nbt::NbtFileFormat           format,
+               nbt::NbtCompressionType      compressionType,
+               nbt::NbtCompressionLevel     compressionLevel,
+               std::optional<int>           headerVersion,
+               std::size_t                  compressionThreads) {
+                if (compressionThreads == 1) { return nbt::io::saveToFile(nbt, path, format, compressionType, compressionLevel, headerVersion); }
+                auto          content = serializeBinary(nbt, format, compressionType, compressionLevel, headerVersion, compressionThreads);
+                std::ofstream file(path, std::ios::binary);
+                file.write(content.data(), static_cast<std::streamsize>(content.size()));
+                file.close();
+                return !file.fail();
+            },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("nbt"),
             py::arg("path"),
-            py::arg("format")            = nbt::NbtFileFormat::LittleEndian,
-            py::arg("compression_type")  = nbt::NbtCompressionType::Gzip,
-            py::arg("compression_level") = nbt::NbtCompressionLevel::Default,
-            py::arg("header_version")    = std::nullopt,
+            py::arg("format")              = nbt::NbtFileFormat::LittleEndian,
+            py::arg("compression_type")    = nbt::NbtCompressionType::Gzip,
+            py::arg("compression_level")   = nbt::NbtCompressionLevel::Default,
+            py::arg("header_version")      = std::nullopt,
+            py::arg("compression_threads") = 1,
             "Save CompoundTag to a file\nArgs:\n    nbt (CompoundTag): Tag to save\n    path (os.PathLike): Output file path\n    format (NbtFileFormat): "
             "Output format (default: LittleEndian)\n    compression_type (CompressionType): Compression method (default: Gzip)\n    compression_level "
-            "(CompressionLevel): Compression level (default: Default)\n    header_version (Optional[int]): NBT header storage version\nReturns:\n    bool: "
-            "True if successful, False otherwise"
+            "(CompressionLevel): Compression level (default: Default)\n    header_version (Optional[int]): NBT header storage version\n    "
+            "compression_threads (int): Compress blocks on this many threads, 0 for one per CPU (default: 1)\nReturns:\n    bool: True if successful, False "
+            "otherwise"
+        )
+        .def(
+            "dump_async",
+            [](nbt::CompoundTag const&      nbt,
+               std::filesystem::path const& path,
+               nbt::NbtFileFormat           format,
+               nbt::NbtCompressionType      compressionType,
+               nbt::NbtCompressionLevel     compressionLevel,
+               std::optional<int>           headerVersion,
+               std::size_t                  compressionThreads) {
+                auto snapshot = std::make_shared<nbt::CompoundTag const>(nbt);
+                return submitWrite(path, [=](std::filesystem::path const& temp) {
+                    return writeContent(temp, serializeBinary(*snapshot, format, compressionType, compressionLevel, headerVersion, compressionThreads));
+                });
+            },
+            py::arg("nbt"),
+            py::arg("path"),
+            py::arg("format")              = nbt::NbtFileFormat::LittleEndian,
+            py::arg("compression_type")    = nbt::NbtCompressionType::Gzip,
+            py::arg("compression_level")   = nbt::NbtCompressionLevel::Default,
+            py::arg("header_version")      = std::nullopt,
+            py::arg("compression_threads") = 1,
+            "Save CompoundTag to a file on the background writer thread\nThe tag is copied before returning, then serialized, compressed, written to a "
+            "temporary file, flushed to disk and renamed over path, so a crash never leaves a truncated file\nA queued save of the same path that has not "
+            "started yet is replaced by this one\nArgs:\n    nbt (CompoundTag): Tag to save\n    path (os.PathLike): Output file path\n    format "
+            "(NbtFileFormat): Output format (default: LittleEndian)\n    compression_type (CompressionType): Compression method (default: Gzip)\n    "
+            "compression_level (CompressionLevel): Compression level (default: Default)\n    header_version (Optional[int]): NBT header storage "
+            "version\n    compression_threads (int): Compress blocks on this many threads, 0 for one per CPU (default: 1)\nReturns:\n    WriteHandle"
+        )
+        .def(
+            "wait_writes",
+            &waitForWrites,
+            py::call_guard<py::gil_scoped_release>(),
+            "Block until every save queued by dump_async and NbtFile.save_async has finished"
         )
         .def(
             "load_snbt",
             &nbt::io::parseSnbtFromFile,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("path"),
             "Parse CompoundTag from SNBT (String NBT) file\nArgs:\n    path (os.PathLike): Path to SNBT file\nReturns:\n    CompoundTag or None if parsing "
             "fails"
@@ -107,6 +495,7 @@ void bindNbtIO(py::module& m) {
         .def(
             "loads_snbt",
             &nbt::io::parseSnbtFromContent,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("content"),
             py::arg("parsed_length") = std::nullopt,
             "Parse CompoundTag from SNBT (String NBT)\nArgs:\n    content (str): SNBT content\nReturns:\n    CompoundTag or None if parsing fails"
@@ -114,6 +503,7 @@ void bindNbtIO(py::module& m) {
         .def(
             "loads_json",
             &nbt::CompoundTag::fromJson,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("content"),
             py::arg("parsed_length") = std::nullopt,
             "Parse CompoundTag from JSON\nArgs:\n    content (str): SNBT content\n\nReturns:\n    CompoundTag or None if parsing fails"
@@ -121,6 +511,7 @@ void bindNbtIO(py::module& m) {
         .def(
             "dump_snbt",
             &nbt::io::saveSnbtToFile,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("nbt"),
             py::arg("path"),
             py::arg("format")        = nbt::SnbtFormat::Default,
@@ -133,6 +524,7 @@ void bindNbtIO(py::module& m) {
         .def(
             "dumps_snbt",
             [](nbt::CompoundTag const& nbt, nbt::SnbtFormat format, uint8_t indent) { return nbt.toSnbt(format, indent); },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("nbt"),
             py::arg("format") = nbt::SnbtFormat::Default,
             py::arg("indent") = 4,
@@ -142,7 +534,9 @@ void bindNbtIO(py::module& m) {
         .def(
             "validate_content",
             [](py::buffer buffer, nbt::NbtFileFormat format, bool strict_match_size) {
-                return nbt::io::validateContent(to_cpp_stringview(buffer), format, strict_match_size);
+                auto                     content = to_cpp_string(buffer);
+                py::gil_scoped_release release;
+                return nbt::io::validateContent(content, format, strict_match_size);
             },
             py::arg("content"),
             py::arg("format")            = nbt::NbtFileFormat::LittleEndian,
@@ -154,6 +548,7 @@ void bindNbtIO(py::module& m) {
         .def(
             "validate_file",
             &nbt::io::validateFile,
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("path"),
             py::arg("format")            = nbt::NbtFileFormat::LittleEndian,
             py::arg("file_memory_map")   = false,
@@ -164,31 +559,71 @@ void bindNbtIO(py::module& m) {
         )
         .def(
             "loads_base64",
-            &nbt::io::parseFromBsae64,
+            [](std::string_view content, std::optional<nbt::NbtFileFormat> format, bool strict_match_size, bool strict_base64)
+                -> std::optional<nbt::CompoundTag> {
+                auto binary = strict_base64 ? fromBase64Strict(content) : fromBase64(content);
+                if (!binary) { return std::nullopt; }
+                return parseContent(*binary, format, strict_match_size);
+            },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("content"),
             py::arg("format")            = std::nullopt,
             py::arg("strict_match_size") = true,
+            py::arg("strict_base64")     = false,
             "Parse CompoundTag from Base64-encoded NBT\nArgs:\n    content (str): Base64-encoded NBT data\n    format (NbtFileFormat, optional): Force "
-            "specific format (autodetect if None)\n    strict_match_size (bool): Strictly match nbt content size (default: True)\nReturns:\n    CompoundTag or "
-            "None if parsing fails"
+            "specific format (autodetect if None)\n    strict_match_size (bool): Strictly match nbt content size (default: True)\n    strict_base64 (bool): "
+            "Only accept RFC 4648 Base64 with the standard alphabet and padding, instead of also skipping whitespace and accepting the URL-safe "
+            "alphabet and missing padding (default: False)\nReturns:\n    CompoundTag or None if the Base64 is malformed or parsing fails"
         )
         .def(
             "dumps_base64",
-            &nbt::io::saveAsBase64,
+            [](nbt::CompoundTag const&  nbt,
+               nbt::NbtFileFormat       format,
+               nbt::NbtCompressionType  compressionType,
+               nbt::NbtCompressionLevel compressionLevel,
+               std::optional<int>       headerVersion,
+               std::size_t              compressionThreads) {
+                if (compressionThreads == 1) { return nbt::io::saveAsBase64(nbt, format, compressionType, compressionLevel, headerVersion); }
+                return toBase64(serializeBinary(nbt, format, compressionType, compressionLevel, headerVersion, compressionThreads));
+            },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("nbt"),
-            py::arg("format")            = nbt::NbtFileFormat::LittleEndian,
-            py::arg("compression_type")  = nbt::NbtCompressionType::Gzip,
-            py::arg("compression_level") = nbt::NbtCompressionLevel::Default,
-            py::arg("header_version")    = std::nullopt,
+            py::arg("format")              = nbt::NbtFileFormat::LittleEndian,
+            py::arg("compression_type")    = nbt::NbtCompressionType::Gzip,
+            py::arg("compression_level")   = nbt::NbtCompressionLevel::Default,
+            py::arg("header_version")      = std::nullopt,
+            py::arg("compression_threads") = 1,
             "Serialize CompoundTag to Base64 string\nArgs:\n    nbt (CompoundTag): Tag to serialize\n    format (NbtFileFormat): Output format (default: "
             "LittleEndian)\n    compression_type (CompressionType): Compression method (default: Gzip)\n    compression_level (CompressionLevel): Compression "
-            "level (default: Default)\n    header_version (Optional[int]): NBT header storage version\nReturns:\n    str: Base64-encoded NBT data"
+            "level (default: Default)\n    header_version (Optional[int]): NBT header storage version\n    compression_threads (int): Compress blocks on this many "
+            "threads, 0 for one per CPU (default: 1)\nReturns:\n    str: Base64-encoded NBT data"
         )
         .def(
             "open",
-            [](std::filesystem::path const& path) { return nbt::open(path); },
+            [](std::filesystem::path const& path) -> std::unique_ptr<nbt::NbtFile> {
+                auto file = nbt::open(path);
+                if (!file) { return nullptr; }
+                return std::make_unique<TrackedNbtFile>(std::move(*file));
+            },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("path"),
             "Open a NBT file (auto detect)\nArgs:\n    path (os.PathLike): NBT file path\nReturns:\n    Optional[NbtFile]: NbtFile or None if open failed"
+        )
+        .def(
+            "set_inflate_backend",
+            [](InflateBackend backend) {
+                if (!setInflateBackend(backend)) { throw py::value_error(std::format("inflate backend {} is not available in this build", ENUM(backend))); }
+            },
+            py::arg("backend"),
+            "Select the decompressor used by load, loads, loads_base64 and the batch loaders\nArgs:\n    backend (InflateBackend): ZLIB or LIBDEFLATE "
+            "(whole-buffer inflate, default when available)"
+        )
+        .def("get_inflate_backend", &getInflateBackend, "Get the decompressor used by the parse functions\nReturns:\n    InflateBackend")
+        .def(
+            "is_inflate_backend_available",
+            &isInflateBackendAvailable,
+            py::arg("backend"),
+            "Check if a decompressor is available in this build\nArgs:\n    backend (InflateBackend): Backend to check\nReturns:\n    bool"
         );
 }
 
@@ -27,6 +27,14 @@ PYBIND11_MODULE(_NBT, m) {
     bindCompoundTag(m);
     bindIntArrayTag(m);
     bindLongArrayTag(m);
+    bindNbtPath(m);
+    bindNbtSchema(m);
+    bindNbtPatch(m);
+    bindLazyCompoundTag(m);
+    bindFrozenCompoundTag(m);
+    bindNbtEventReader(m);
+    bindRegionFile(m);
+    bindAsyncWriter(m);
     bindNbtIO(m);
     bindNbtFile(m);
 }
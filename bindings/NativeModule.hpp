@@ -6,6 +6,9 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #pragma once
+#include "NbtPath.hpp"
+#include <bit>
+#include <cstring>
 #include <format>
 #include <magic_enum/magic_enum.hpp>
 #include <nbt/NBT.hpp>
@@ -27,9 +30,64 @@ namespace rapidnbt {
 
 inline py::bytes to_py_bytes(std::string_view sv) { return py::bytes(sv.data(), sv.size()); }
 
-inline std::string_view to_cpp_stringview(py::buffer const& buf) {
+// str for valid UTF-8, bytes otherwise
+inline py::object to_py_text(std::string_view value) {
+    PyObject* result = PyUnicode_DecodeUTF8(value.data(), static_cast<Py_ssize_t>(value.size()), nullptr);
+    if (!result) {
+        PyErr_Clear();
+        return to_py_bytes(value);
+    }
+    return py::reinterpret_steal<py::object>(result);
+}
+
+// Bytes of a requested buffer, info.size counts items rather than bytes
+inline std::string_view to_cpp_stringview(py::buffer_info const& info) {
+    return std::string_view(static_cast<const char*>(info.ptr), static_cast<std::size_t>(info.size * info.itemsize));
+}
+
+inline std::string_view to_cpp_stringview(py::buffer const& buf) { return to_cpp_stringview(buf.request()); }
+
+// Owned copy of a buffer, safe to read after the GIL has been released
+inline std::string to_cpp_string(py::buffer const& buf) {
     py::buffer_info info = buf.request();
-    return std::string_view(static_cast<const char*>(info.ptr), info.size);
+    return std::string(to_cpp_stringview(info));
+}
+
+// Replace the storage with the items of a buffer, using one memcpy when it holds C-contiguous native integers of the same
+// width and falling back to element-wise conversion otherwise
+template <std::integral T>
+inline void assign_from_buffer(std::vector<T>& storage, py::buffer const& buf) {
+    py::buffer_info  info   = buf.request();
+    std::string_view format = info.format;
+    bool             native = true;
+    if (!format.empty() && std::string_view("@=<>!").contains(format.front())) {
+        auto order = format.front();
+        native     = !(order == '<' && std::endian::native != std::endian::little) && !((order == '>' || order == '!') && std::endian::native != std::endian::big);
+        format.remove_prefix(1);
+    }
+    bool contiguous = true;
+    auto expected   = info.itemsize;
+    for (auto dim = info.ndim; dim-- > 0;) {
+        if (info.shape[dim] > 1 && info.strides[dim] != expected) { contiguous = false; }
+        expected *= info.shape[dim];
+    }
+    if (!native || !contiguous || info.itemsize != sizeof(T) || format.size() != 1 || !std::string_view("bBhHiIlLqQnN").contains(format.front())) {
+        storage = buf.cast<std::vector<T>>();
+        return;
+    }
+    storage.resize(static_cast<std::size_t>(info.size));
+    if (info.size > 0) { std::memcpy(storage.data(), info.ptr, storage.size() * sizeof(T)); }
+}
+
+// Dict key as UTF-8, reading exact str objects without going through the type caster
+inline std::string to_cpp_key(py::handle key) {
+    if (PyUnicode_CheckExact(key.ptr())) {
+        Py_ssize_t size = 0;
+        auto       data = PyUnicode_AsUTF8AndSize(key.ptr(), &size);
+        if (!data) { throw py::error_already_set(); }
+        return std::string(data, static_cast<std::size_t>(size));
+    }
+    return py::cast<std::string>(key);
 }
 
 template <std::integral T>
@@ -65,7 +123,24 @@ inline std::string py_type_name(py::object const& obj) {
     return typeName;
 }
 
-std::unique_ptr<nbt::Tag> makeNativeTag(py::object const& obj);
+std::unique_ptr<nbt::Tag>         makeNativeTag(py::object const& obj);
+std::unique_ptr<nbt::CompoundTag> makeNativeCompound(py::dict const& obj);
+
+// Move the contents out of a tag, leaving it an empty tag of the same type
+std::unique_ptr<nbt::Tag> releaseTag(nbt::CompoundTagVariant& tag);
+std::unique_ptr<nbt::Tag> releaseTag(nbt::Tag& tag);
+
+// Like makeNativeTag, but tags and CompoundTagVariants are moved out of instead of copied
+// Throw ValueError if obj is the tag target refers to or one of its ancestors
+std::unique_ptr<nbt::Tag> takeNativeTag(py::object const& obj, py::handle target);
+
+// Move the contents out of slot before it is removed from its parent, a reference to the tag slot holds is rebound to the
+// returned tag and a reference to slot itself to an empty tag, references reached through them stay valid
+py::object takeTag(nbt::CompoundTagVariant& slot);
+
+// Python object for the match at the end of a trace, tags are returned as references kept alive by the tag they were
+// reached through
+py::object to_py_path_match(std::vector<NbtPathMatch> const& trace, py::handle root);
 
 void bindEnums(py::module& m);
 void bindCompoundTagVariant(py::module& m);
@@ -83,6 +158,14 @@ void bindListTag(py::module& m);
 void bindCompoundTag(py::module& m);
 void bindIntArrayTag(py::module& m);
 void bindLongArrayTag(py::module& m);
+void bindNbtPath(py::module& m);
+void bindNbtSchema(py::module& m);
+void bindNbtPatch(py::module& m);
+void bindLazyCompoundTag(py::module& m);
+void bindFrozenCompoundTag(py::module& m);
+void bindNbtEventReader(py::module& m);
+void bindRegionFile(py::module& m);
+void bindAsyncWriter(py::module& m);
 void bindNbtIO(py::module& m);
 void bindNbtFile(py::module& m);
 
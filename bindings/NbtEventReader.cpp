@@ -0,0 +1,305 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "NbtEventReader.hpp"
+#include "Compression.hpp"
+#include "NativeModule.hpp"
+
+namespace rapidnbt {
+
+namespace {
+
+constexpr std::size_t FORMAT_PROBE_SIZE     = 1u << 20;
+constexpr std::size_t MAX_FORMAT_PROBE_SIZE = 1u << 26;
+
+std::string readPrefix(ByteSource& source, std::size_t probeSize, bool& complete) {
+    // One byte past the probe tells whether content of exactly the probe size is complete
+    std::string prefix(probeSize + 1, '\0');
+    std::size_t size = 0;
+    complete         = false;
+    try {
+        while (size < prefix.size()) {
+            auto count = source.read(prefix.data() + size, prefix.size() - size);
+            if (count == 0) {
+                complete = true;
+                break;
+            }
+            size += count;
+        }
+    } catch (std::runtime_error const&) {}
+    prefix.resize(size);
+    return prefix;
+}
+
+// Guess the format from a growing prefix of the content, `open` returns a new source positioned at its beginning
+template <typename Open>
+std::optional<nbt::NbtFileFormat> probeFormat(Open&& open) {
+    for (auto probeSize = FORMAT_PROBE_SIZE;; probeSize *= 4) {
+        auto source = open();
+        if (!source) { return std::nullopt; }
+        bool complete  = false;
+        bool ambiguous = false;
+        auto prefix    = readPrefix(*source, probeSize, complete);
+        auto format    = guessFormat(prefix, complete, ambiguous);
+        // Give up rather than guess when several formats still fit the largest probe
+        if (!ambiguous || probeSize >= MAX_FORMAT_PROBE_SIZE) { return format; }
+    }
+}
+
+} // namespace
+
+NbtEventReader::NbtEventReader(std::shared_ptr<ContentBuffer> content, std::unique_ptr<ByteSource> source, nbt::NbtFileFormat format)
+: mContent(std::move(content)),
+  mSource(std::move(source)),
+  mReader(StreamInput(*mSource), encodingOf(format)),
+  mFormat(format) {}
+
+std::unique_ptr<NbtEventReader> NbtEventReader::fromContent(std::shared_ptr<ContentBuffer> content, std::optional<nbt::NbtFileFormat> format) {
+    if (!content) { return nullptr; }
+    auto view       = content->view();
+    auto compressed = detectCompression(view) != nbt::NbtCompressionType::None;
+    if (!format) {
+        if (compressed) {
+            format = probeFormat([&] { return std::make_unique<InflateSource>(std::make_unique<MemorySource>(view)); });
+        } else {
+            bool ambiguous = false;
+            format         = guessFormat(view, true, ambiguous);
+        }
+        if (!format) { return nullptr; }
+    }
+    std::unique_ptr<ByteSource> source = std::make_unique<MemorySource>(view);
+    if (compressed) { source = std::make_unique<InflateSource>(std::move(source)); }
+    return std::unique_ptr<NbtEventReader>(new NbtEventReader(std::move(content), std::move(source), *format));
+}
+
+std::unique_ptr<NbtEventReader>
+NbtEventReader::fromFile(std::filesystem::path const& path, std::optional<nbt::NbtFileFormat> format, bool fileMemoryMap) {
+    if (fileMemoryMap) { return fromContent(ContentBuffer::fromFile(path, true), format); }
+    auto open = [&]() -> std::unique_ptr<ByteSource> {
+        auto file = std::make_unique<FileSource>(path);
+        if (!file->isOpen()) { return nullptr; }
+        char head[2]{};
+        auto size = file->read(head, sizeof(head));
+        file      = std::make_unique<FileSource>(path);
+        if (detectCompression({head, size}) != nbt::NbtCompressionType::None) { return std::make_unique<InflateSource>(std::move(file)); }
+        return file;
+    };
+    auto source = open();
+    if (!source) { return nullptr; }
+    if (!format) {
+        format = probeFormat(open);
+        if (!format) { return nullptr; }
+        source = open();
+    }
+    return std::unique_ptr<NbtEventReader>(new NbtEventReader(nullptr, std::move(source), *format));
+}
+
+bool NbtEventReader::next(NbtEvent& event) {
+    if (mFinished) { return false; }
+    event.mKey   = {};
+    event.mSize  = 0;
+    event.mValue = std::monostate{};
+    if (!mStarted) {
+        mStarted = true;
+        mReader.skip(headerSizeOf(mFormat));
+        if (mReader.readType() != nbt::Tag::Type::Compound) { throw NbtFormatError("root tag is not a CompoundTag"); }
+        mReader.readString();
+        return beginValue(nbt::Tag::Type::Compound, event);
+    }
+    if (mPendingType) {
+        auto type = *mPendingType;
+        mPendingType.reset();
+        return beginValue(type, event);
+    }
+    auto& frame = mStack.back();
+    if (frame.mType == nbt::Tag::Type::Compound) {
+        auto type = mReader.readType();
+        if (type == nbt::Tag::Type::End) {
+            mStack.pop_back();
+            mFinished      = mStack.empty();
+            event.mType    = NbtEventType::EndCompound;
+            event.mTagType = nbt::Tag::Type::Compound;
+            return true;
+        }
+        event.mKey     = mReader.readString();
+        event.mType    = NbtEventType::Key;
+        event.mTagType = type;
+        mPendingType   = type;
+        return true;
+    }
+    if (frame.mRemaining == 0) {
+        mStack.pop_back();
+        event.mType    = NbtEventType::EndList;
+        event.mTagType = nbt::Tag::Type::List;
+        return true;
+    }
+    --frame.mRemaining;
+    return beginValue(frame.mElementType, event);
+}
+
+bool NbtEventReader::beginValue(nbt::Tag::Type type, NbtEvent& event) {
+    switch (type) {
+    case nbt::Tag::Type::Compound:
+        if (mStack.size() > MAX_NBT_DEPTH) { throw NbtFormatError("nbt nesting too deep"); }
+        mStack.push_back({nbt::Tag::Type::Compound, nbt::Tag::Type::End, 0});
+        event.mType    = NbtEventType::BeginCompound;
+        event.mTagType = nbt::Tag::Type::Compound;
+        return true;
+    case nbt::Tag::Type::List: {
+        if (mStack.size() > MAX_NBT_DEPTH) { throw NbtFormatError("nbt nesting too deep"); }
+        auto elementType = mReader.readType();
+        auto size        = mReader.readLength();
+        mStack.push_back({nbt::Tag::Type::List, elementType, size});
+        event.mType    = NbtEventType::BeginList;
+        event.mTagType = elementType;
+        event.mSize    = size;
+        return true;
+    }
+    default:
+        event.mType    = NbtEventType::Value;
+        event.mTagType = type;
+        readValue(type, event.mValue);
+        return true;
+    }
+}
+
+void NbtEventReader::readValue(nbt::Tag::Type type, NbtEvent::Value& value) {
+    switch (type) {
+    case nbt::Tag::Type::Byte:
+        value = static_cast<int64_t>(mReader.readByte());
+        break;
+    case nbt::Tag::Type::Short:
+        value = static_cast<int64_t>(mReader.readShort());
+        break;
+    case nbt::Tag::Type::Int:
+        value = static_cast<int64_t>(mReader.readInt());
+        break;
+    case nbt::Tag::Type::Long:
+        value = mReader.readLong();
+        break;
+    case nbt::Tag::Type::Float:
+        value = static_cast<double>(mReader.readFloat());
+        break;
+    case nbt::Tag::Type::Double:
+        value = mReader.readDouble();
+        break;
+    case nbt::Tag::Type::ByteArray:
+        value = mReader.readBytes(mReader.readLength());
+        break;
+    case nbt::Tag::Type::String:
+        value = mReader.readString();
+        break;
+    case nbt::Tag::Type::IntArray: {
+        auto                 size = mReader.readLength();
+        std::vector<int32_t> array;
+        array.reserve(std::min<std::size_t>(size, 1u << 16));
+        for (std::size_t i = 0; i < size; ++i) { array.push_back(mReader.readInt()); }
+        value = std::move(array);
+        break;
+    }
+    case nbt::Tag::Type::LongArray: {
+        auto                 size = mReader.readLength();
+        std::vector<int64_t> array;
+        array.reserve(std::min<std::size_t>(size, 1u << 16));
+        for (std::size_t i = 0; i < size; ++i) { array.push_back(mReader.readLong()); }
+        value = std::move(array);
+        break;
+    }
+    default:
+        value = std::monostate{};
+    }
+}
+
+void visit(NbtEventReader& reader, NbtVisitor& visitor) {
+    NbtEvent event;
+    while (reader.next(event)) {
+        switch (event.mType) {
+        case NbtEventType::BeginCompound:
+            visitor.beginCompound();
+            break;
+        case NbtEventType::EndCompound:
+            visitor.endCompound();
+            break;
+        case NbtEventType::BeginList:
+            visitor.beginList(event.mTagType, event.mSize);
+            break;
+        case NbtEventType::EndList:
+            visitor.endList();
+            break;
+        case NbtEventType::Key:
+            visitor.key(event.mKey);
+            break;
+        case NbtEventType::Value:
+            visitor.value(event.mTagType, event.mValue);
+            break;
+        }
+    }
+}
+
+namespace {
+
+py::object to_py_event_value(NbtEvent const& event) {
+    switch (event.mType) {
+    case NbtEventType::Key:
+        return to_py_text(event.mKey);
+    case NbtEventType::BeginList:
+        return py::int_(event.mSize);
+    case NbtEventType::Value:
+        return std::visit(
+            [&](auto const& value) -> py::object {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, std::monostate>) {
+                    return py::none();
+                } else if constexpr (std::is_same_v<T, std::string_view>) {
+                    return event.mTagType == nbt::Tag::Type::String ? to_py_text(value) : to_py_bytes(value);
+                } else {
+                    return py::cast(value);
+                }
+            },
+            event.mValue
+        );
+    default:
+        return py::none();
+    }
+}
+
+} // namespace
+
+void bindNbtEventReader(py::module& m) {
+    auto sm = m.def_submodule("nbt_event_reader", "Streaming event parser over binary NBT\nUse nbtio.iter_events() to create a reader.");
+
+    py::native_enum<NbtEventType>(sm, "NbtEventType", "enum.Enum", "Events emitted by NbtEventReader")
+        .value("BEGIN_COMPOUND", NbtEventType::BeginCompound)
+        .value("END_COMPOUND", NbtEventType::EndCompound)
+        .value("BEGIN_LIST", NbtEventType::BeginList)
+        .value("END_LIST", NbtEventType::EndList)
+        .value("KEY", NbtEventType::Key)
+        .value("VALUE", NbtEventType::Value)
+        .export_values()
+        .finalize();
+
+    py::class_<NbtEventReader>(sm, "NbtEventReader")
+        .def("format", &NbtEventReader::format, "Get the binary format of the content")
+        .def("__iter__", [](NbtEventReader& self) -> NbtEventReader& { return self; }, py::return_value_policy::reference_internal)
+        .def(
+            "__next__",
+            [](NbtEventReader& self) {
+                NbtEvent event;
+                if (!self.next(event)) { throw py::stop_iteration(); }
+                return py::make_tuple(event.mType, event.mTagType, to_py_event_value(event));
+            },
+            "Get the next (event, tag_type, value) tuple\nvalue is the key for KEY, the element count for BEGIN_LIST, the tag value for VALUE and "
+            "None otherwise"
+        )
+        .def(
+            "__repr__",
+            [](NbtEventReader const& self) { return std::format("<rapidnbt.NbtEventReader(format={0}) object at 0x{1:0{2}X}>", ENUM(self.format()), ADDRESS); },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
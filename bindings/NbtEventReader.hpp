@@ -0,0 +1,78 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "ContentBuffer.hpp"
+#include "NbtReader.hpp"
+#include <variant>
+#include <vector>
+
+namespace rapidnbt {
+
+enum class NbtEventType { BeginCompound, EndCompound, BeginList, EndList, Key, Value };
+
+// Views inside an event are only valid until the next call to NbtEventReader::next()
+struct NbtEvent {
+    using Value = std::variant<std::monostate, int64_t, double, std::string_view, std::vector<int32_t>, std::vector<int64_t>>;
+
+    NbtEventType     mType{NbtEventType::Value};
+    nbt::Tag::Type   mTagType{nbt::Tag::Type::End}; // value type, or element type for BeginList
+    std::string_view mKey{};
+    std::size_t      mSize{0};                       // element count for BeginList
+    Value            mValue{};
+};
+
+class NbtVisitor {
+public:
+    virtual ~NbtVisitor() = default;
+
+    virtual void beginCompound() {}
+    virtual void endCompound() {}
+    virtual void beginList(nbt::Tag::Type /*elementType*/, std::size_t /*size*/) {}
+    virtual void endList() {}
+    virtual void key(std::string_view /*key*/) {}
+    virtual void value(nbt::Tag::Type /*type*/, NbtEvent::Value const& /*value*/) {}
+};
+
+// Pull parser which turns binary NBT into events straight from the byte stream, in constant memory
+class NbtEventReader {
+public:
+    static std::unique_ptr<NbtEventReader> fromContent(std::shared_ptr<ContentBuffer> content, std::optional<nbt::NbtFileFormat> format);
+    static std::unique_ptr<NbtEventReader>
+    fromFile(std::filesystem::path const& path, std::optional<nbt::NbtFileFormat> format, bool fileMemoryMap);
+
+    nbt::NbtFileFormat format() const noexcept { return mFormat; }
+
+    // Returns false once the root compound has been closed
+    bool next(NbtEvent& event);
+
+private:
+    struct Frame {
+        nbt::Tag::Type mType;
+        nbt::Tag::Type mElementType;
+        std::size_t    mRemaining;
+    };
+
+    NbtEventReader(std::shared_ptr<ContentBuffer> content, std::unique_ptr<ByteSource> source, nbt::NbtFileFormat format);
+
+    bool beginValue(nbt::Tag::Type type, NbtEvent& event);
+    void readValue(nbt::Tag::Type type, NbtEvent::Value& value);
+
+    std::shared_ptr<ContentBuffer> mContent;
+    std::unique_ptr<ByteSource>    mSource;
+    NbtStreamReader                mReader;
+    nbt::NbtFileFormat             mFormat;
+    std::vector<Frame>             mStack{};
+    std::optional<nbt::Tag::Type>  mPendingType{};
+    bool                           mStarted{false};
+    bool                           mFinished{false};
+};
+
+// Drive a visitor over every remaining event of the reader
+void visit(NbtEventReader& reader, NbtVisitor& visitor);
+
+} // namespace rapidnbt
@@ -5,10 +5,74 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include "AsyncWriter.hpp"
 #include "NativeModule.hpp"
+#include "NbtFile.hpp"
+#include "TagHash.hpp"
 
 namespace rapidnbt {
 
+TrackedNbtFile::TrackedNbtFile(nbt::NbtFile&& file) : nbt::NbtFile(std::move(file)) { markSaved(); }
+
+bool TrackedNbtFile::isModified() const {
+    settleSaves();
+    if (fileSettings(*this) != mSaved.mSettings || size() != mSaved.mKeyHashes.size()) { return true; }
+    for (auto const& [key, value] : *this) {
+        auto hash = mSaved.mKeyHashes.find(key);
+        if (hash == mSaved.mKeyHashes.end() || hash->second != contentHash(value)) { return true; }
+    }
+    return false;
+}
+
+std::vector<std::string> TrackedNbtFile::changedKeys() const {
+    settleSaves();
+    std::vector<std::string> result;
+    for (auto const& [key, value] : *this) {
+        auto hash = mSaved.mKeyHashes.find(key);
+        if (hash == mSaved.mKeyHashes.end() || hash->second != contentHash(value)) { result.push_back(key); }
+    }
+    for (auto const& [key, hash] : mSaved.mKeyHashes) {
+        if (!contains(key)) { result.push_back(key); }
+    }
+    return result;
+}
+
+void TrackedNbtFile::markSaved() { mSaved = currentState(); }
+
+void TrackedNbtFile::markSavedOnSuccess(WriteHandle handle) { mPendingSaves.emplace_back(std::move(handle), currentState()); }
+
+TrackedNbtFile::SavedState TrackedNbtFile::currentState() const {
+    SavedState state{{}, fileSettings(*this)};
+    state.mKeyHashes.reserve(size());
+    for (auto const& [key, value] : *this) { state.mKeyHashes.emplace(key, contentHash(value)); }
+    return state;
+}
+
+void TrackedNbtFile::settleSaves() const {
+    // The writer thread finishes writes in submission order, so a save still running blocks the ones after it
+    while (!mPendingSaves.empty() && mPendingSaves.front().first.done()) {
+        if (mPendingSaves.front().first.result()) { mSaved = std::move(mPendingSaves.front().second); }
+        mPendingSaves.pop_front();
+    }
+}
+
+namespace {
+
+// Content of the file as NbtFile::save writes it
+std::string serializeFile(nbt::NbtFile const& file) {
+    if (file.mIsSnbtFile) { return file.toSnbt(file.mSnbtFormat, file.mSnbtIndent, file.mSnbtNumberFormat); }
+    return nbt::io::saveAsBinary(file, file.mFileFormat, file.mCompressionType, file.mCompressionLevel, std::nullopt);
+}
+
+} // namespace
+
+void saveIfModified(nbt::NbtFile& file) {
+    auto tracked = dynamic_cast<TrackedNbtFile*>(&file);
+    if (tracked && !tracked->isModified()) { return; }
+    file.save();
+    if (tracked) { tracked->markSaved(); }
+}
+
 void bindNbtFile(py::module& m) {
     auto sm = m.def_submodule("nbt_file", "NBT file\nUse nbtio.open() to open a NBT file.");
 
@@ -24,11 +88,44 @@ void bindNbtFile(py::module& m) {
 
         .def(
             "flush",
+            [](nbt::NbtFile& self) {
+                if (!self.mAutoSave) { throw py::attribute_error("NbtFile is read only."); }
+                saveIfModified(self);
+            },
+            "flush data to the file.\nNothing is written if neither the tags nor the file settings changed since the file was opened or last saved"
+        )
+        .def(
+            "save_async",
+            [](nbt::NbtFile& self) {
+                if (!self.mAutoSave) { throw py::attribute_error("NbtFile is read only."); }
+                auto tracked = dynamic_cast<TrackedNbtFile*>(&self);
+                if (tracked && !tracked->isModified()) { return WriteHandle::completed(self.mFilePath, true); }
+                auto snapshot = std::make_shared<nbt::NbtFile>(self);
+                auto handle   = submitWrite(self.mFilePath, [snapshot](std::filesystem::path const& temp) { return writeContent(temp, serializeFile(*snapshot)); });
+                if (tracked) { tracked->markSavedOnSuccess(handle); }
+                return handle;
+            },
+            "Save to file_path on the background writer thread\nThe tags are copied before returning, then written to a "
+            "temporary file, flushed to disk and renamed over the file, so a crash never leaves a truncated file\nNothing is written if the file is "
+            "unmodified, the file only counts as saved once the write succeeded\nReturns:\n    WriteHandle"
+        )
+        .def(
+            "is_modified",
             [](nbt::NbtFile const& self) {
-                if (self.mAutoSave) { self.save(); }
-                throw py::attribute_error("NbtFile is read only.");
+                auto tracked = dynamic_cast<TrackedNbtFile const*>(&self);
+                return !tracked || tracked->isModified();
+            },
+            "Check if the tags or file settings changed since the file was opened or last saved"
+        )
+        .def(
+            "changed_keys",
+            [](nbt::NbtFile const& self) -> std::vector<std::string> {
+                if (auto tracked = dynamic_cast<TrackedNbtFile const*>(&self)) { return tracked->changedKeys(); }
+                std::vector<std::string> result;
+                for (auto const& [key, value] : self) { result.push_back(key); }
+                return result;
             },
-            "flush data to the file."
+            "Get the top-level keys added, changed or removed since the file was opened or last saved\nReturns:\n    List[str]"
         )
 
         .def(
@@ -51,12 +148,12 @@ void bindNbtFile(py::module& m) {
         .def(
             "__exit__",
             [](nbt::NbtFile& self, py::object, py::object, py::object) {
-                if (self.mAutoSave) { self.save(); }
+                if (self.mAutoSave) { saveIfModified(self); }
             },
             py::arg("exc_type"),
             py::arg("exc_value"),
             py::arg("traceback"),
-            "Exit context manager"
+            "Exit context manager, saving only if the file was modified"
         );
 }
 
@@ -0,0 +1,65 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "AsyncWriter.hpp"
+#include <deque>
+#include <nbt/NBT.hpp>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rapidnbt {
+
+// Everything besides the tags that decides how the file is written
+inline auto fileSettings(nbt::NbtFile const& file) {
+    return std::tuple(
+        file.mFileFormat,
+        file.mIsSnbtFile,
+        file.mCompressionType,
+        file.mCompressionLevel,
+        file.mSnbtFormat,
+        file.mSnbtIndent,
+        file.mSnbtNumberFormat
+    );
+}
+
+// NbtFile returned by nbtio.open, remembering a content hash of every top-level key as of the last load or save so that
+// unchanged files are not serialized and rewritten
+class TrackedNbtFile : public nbt::NbtFile {
+public:
+    explicit TrackedNbtFile(nbt::NbtFile&& file);
+
+    bool isModified() const;
+
+    // Top-level keys added, changed or removed since the last load or save
+    std::vector<std::string> changedKeys() const;
+
+    void markSaved();
+    // Mark the current content as saved once the background write behind handle succeeds
+    void markSavedOnSuccess(WriteHandle handle);
+
+private:
+    struct SavedState {
+        std::unordered_map<std::string, uint64_t>                   mKeyHashes;
+        decltype(fileSettings(std::declval<nbt::NbtFile const&>())) mSettings;
+    };
+
+    SavedState currentState() const;
+    // Adopt the state of background saves that finished, in submission order
+    void settleSaves() const;
+
+    mutable SavedState                                     mSaved;
+    mutable std::deque<std::pair<WriteHandle, SavedState>> mPendingSaves;
+};
+
+// Save if the file is tracked and modified, or is not tracked at all
+void saveIfModified(nbt::NbtFile& file);
+
+} // namespace rapidnbt
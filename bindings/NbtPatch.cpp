@@ -0,0 +1,352 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "NbtPatch.hpp"
+#include "NativeModule.hpp"
+#include "NbtPath.hpp"
+
+namespace rapidnbt {
+
+namespace {
+
+using Op = NbtPatch::Op;
+
+class PatchBuilder {
+public:
+    explicit PatchBuilder(std::vector<Op>& ops) : mOps(ops) {}
+
+    void diffCompound(nbt::CompoundTag const& from, nbt::CompoundTag const& to) {
+        auto length = mPath.size();
+        for (auto const& [key, value] : from) {
+            if (to.contains(key)) { continue; }
+            pushKey(key);
+            mOps.push_back({Op::Kind::Remove, mPath});
+            mPath.resize(length);
+        }
+        for (auto const& [key, value] : to) {
+            pushKey(key);
+            if (from.contains(key)) {
+                diffValue(from.at(key), value);
+            } else {
+                mOps.push_back({Op::Kind::Set, mPath, value});
+            }
+            mPath.resize(length);
+        }
+    }
+
+private:
+    void pushKey(std::string_view key) {
+        if (!mPath.empty()) { mPath += '.'; }
+        mPath += quotePathKey(key);
+    }
+
+    void diffValue(nbt::CompoundTagVariant const& from, nbt::CompoundTagVariant const& to) {
+        if (from.getType() != to.getType()) {
+            mOps.push_back({Op::Kind::Set, mPath, to});
+            return;
+        }
+        switch (to.getType()) {
+        case nbt::Tag::Type::Compound:
+            return diffCompound(from.as<nbt::CompoundTag>(), to.as<nbt::CompoundTag>());
+        case nbt::Tag::Type::List:
+            return diffList(from.as<nbt::ListTag>(), to.as<nbt::ListTag>());
+        case nbt::Tag::Type::ByteArray:
+            return diffArray(from.as<nbt::ByteArrayTag>(), to.as<nbt::ByteArrayTag>());
+        case nbt::Tag::Type::IntArray:
+            return diffArray(from.as<nbt::IntArrayTag>(), to.as<nbt::IntArrayTag>());
+        case nbt::Tag::Type::LongArray:
+            return diffArray(from.as<nbt::LongArrayTag>(), to.as<nbt::LongArrayTag>());
+        default:
+            if (!(from == to)) { mOps.push_back({Op::Kind::Set, mPath, to}); }
+        }
+    }
+
+    // Equal elements at both ends are kept, elements in the middle are diffed pairwise and the remainder is spliced
+    // A list changing its element type, including to or from an empty list, is replaced whole
+    void diffList(nbt::ListTag const& from, nbt::ListTag const& to) {
+        if (from.getElementType() != to.getElementType()) {
+            mOps.push_back({Op::Kind::Set, mPath, nbt::CompoundTagVariant(to.copy())});
+            return;
+        }
+        auto [prefix, suffix] = commonEnds(from.size(), to.size(), [&](std::size_t i, std::size_t j) { return from[i] == to[j]; });
+        auto paired           = std::min(from.size(), to.size()) - prefix - suffix;
+        auto length           = mPath.size();
+        for (std::size_t i = prefix; i < prefix + paired; ++i) {
+            mPath += std::format("[{}]", i);
+            diffValue(from[i], to[i]);
+            mPath.resize(length);
+        }
+        auto offset  = prefix + paired;
+        auto removed = from.size() - suffix - offset;
+        auto added   = to.size() - suffix - offset;
+        if (removed == 0 && added == 0) { return; }
+        auto elements = std::make_unique<nbt::ListTag>();
+        elements->reserve(added);
+        for (std::size_t i = offset; i < offset + added; ++i) { elements->push_back(to[i].toUniqueCopy()); }
+        mOps.push_back({Op::Kind::Splice, mPath, nbt::CompoundTagVariant(std::move(elements)), offset, removed});
+    }
+
+    template <typename T>
+    void diffArray(T const& from, T const& to) {
+        auto const& before = from.storage();
+        auto const& after  = to.storage();
+        auto [prefix, suffix] = commonEnds(before.size(), after.size(), [&](std::size_t i, std::size_t j) { return before[i] == after[j]; });
+        auto removed          = before.size() - prefix - suffix;
+        auto added            = after.size() - prefix - suffix;
+        if (removed == 0 && added == 0) { return; }
+        auto elements = std::make_unique<T>();
+        elements->storage().assign(after.begin() + prefix, after.begin() + prefix + added);
+        mOps.push_back({Op::Kind::Splice, mPath, nbt::CompoundTagVariant(std::move(elements)), prefix, removed});
+    }
+
+    // Elements are compared with operator==, which stops at the first difference. There are no subtree hashes to compare
+    // instead: tags have no parent links to invalidate a cached hash, and hashing both trees per call costs as much as this
+    template <typename Equal>
+    static std::pair<std::size_t, std::size_t> commonEnds(std::size_t fromSize, std::size_t toSize, Equal&& equal) {
+        auto        shortest = std::min(fromSize, toSize);
+        std::size_t prefix   = 0;
+        while (prefix < shortest && equal(prefix, prefix)) { ++prefix; }
+        std::size_t suffix = 0;
+        while (suffix < shortest - prefix && equal(fromSize - 1 - suffix, toSize - 1 - suffix)) { ++suffix; }
+        return {prefix, suffix};
+    }
+
+    std::vector<Op>& mOps;
+    std::string      mPath;
+};
+
+[[noreturn]] void fail(Op const& op, std::string_view reason) { throw NbtPatchError(std::format("cannot apply patch at \"{}\": {}", op.mPath, reason)); }
+
+std::size_t indexOf(NbtPath::Node const& node, std::size_t size, Op const& op) {
+    auto index = node.mIndex < 0 ? node.mIndex + static_cast<int64_t>(size) : node.mIndex;
+    if (index < 0 || static_cast<std::size_t>(index) >= size) { fail(op, "index out of range"); }
+    return static_cast<std::size_t>(index);
+}
+
+nbt::CompoundTagVariant& child(nbt::CompoundTagVariant& parent, NbtPath::Node const& node, Op const& op) {
+    if (node.mKind == NbtPath::Node::Kind::Key) {
+        if (!parent.hold(nbt::Tag::Type::Compound) || !parent.as<nbt::CompoundTag>().contains(node.mKey)) { fail(op, "missing key"); }
+        return parent.as<nbt::CompoundTag>().at(node.mKey);
+    }
+    if (!parent.hold(nbt::Tag::Type::List)) { fail(op, "not a list"); }
+    auto& list = parent.as<nbt::ListTag>();
+    return list[indexOf(node, list.size(), op)];
+}
+
+template <typename T>
+void spliceArray(nbt::CompoundTagVariant& target, Op const& op) {
+    if (!op.mValue.hold(target.getType())) { fail(op, "splice value type does not match the array"); }
+    auto& storage = target.as<T>().storage();
+    if (op.mOffset + op.mRemoved > storage.size()) { fail(op, "splice range out of bounds"); }
+    auto const& elements = op.mValue.as<T>().storage();
+    auto        position = storage.erase(storage.begin() + op.mOffset, storage.begin() + op.mOffset + op.mRemoved);
+    storage.insert(position, elements.begin(), elements.end());
+}
+
+void spliceList(nbt::ListTag& list, Op const& op) {
+    if (!op.mValue.hold(nbt::Tag::Type::List)) { fail(op, "splice value type does not match the list"); }
+    auto& storage = list.storage();
+    if (op.mOffset + op.mRemoved > storage.size()) { fail(op, "splice range out of bounds"); }
+    auto const& inserted = op.mValue.as<nbt::ListTag>();
+    for (auto const& element : inserted) {
+        if (element.getType() != inserted.getElementType()) { fail(op, "splice elements do not share one type"); }
+    }
+    if (op.mRemoved == storage.size()) {
+        // Nothing of the old list is kept, rebuild it so that the element type follows the new elements
+        nbt::ListTag replacement;
+        replacement.reserve(inserted.size());
+        for (auto const& element : inserted) { replacement.push_back(element.toUniqueCopy()); }
+        list = std::move(replacement);
+        return;
+    }
+    if (inserted.size() > 0 && inserted.getElementType() != list.getElementType()) { fail(op, "splice element type does not match the list"); }
+    auto position = storage.erase(storage.begin() + op.mOffset, storage.begin() + op.mOffset + op.mRemoved);
+    storage.insert(position, inserted.storage().begin(), inserted.storage().end());
+}
+
+void applyOp(nbt::CompoundTag& root, Op const& op) {
+    auto        path  = NbtPath::parse(op.mPath);
+    auto const& nodes = path.nodes();
+    if (nodes.empty() || nodes.front().mKind != NbtPath::Node::Kind::Key) { fail(op, "path must start with a key"); }
+    for (auto const& node : nodes) {
+        if (node.mKind != NbtPath::Node::Kind::Key && node.mKind != NbtPath::Node::Kind::Index) { fail(op, "path may only contain keys and indices"); }
+    }
+    if (op.mKind == Op::Kind::Splice) {
+        if (!root.contains(nodes.front().mKey)) { fail(op, "missing key"); }
+        auto* target = &root.at(nodes.front().mKey);
+        for (std::size_t i = 1; i < nodes.size(); ++i) { target = &child(*target, nodes[i], op); }
+        switch (target->getType()) {
+        case nbt::Tag::Type::ByteArray:
+            return spliceArray<nbt::ByteArrayTag>(*target, op);
+        case nbt::Tag::Type::IntArray:
+            return spliceArray<nbt::IntArrayTag>(*target, op);
+        case nbt::Tag::Type::LongArray:
+            return spliceArray<nbt::LongArrayTag>(*target, op);
+        case nbt::Tag::Type::List:
+            return spliceList(target->as<nbt::ListTag>(), op);
+        default:
+            fail(op, "splice target is not an array or list");
+        }
+    }
+    // Walk to the parent of the last node
+    auto& last = nodes.back();
+    if (nodes.size() == 1) {
+        if (op.mKind == Op::Kind::Set) {
+            root[last.mKey] = op.mValue;
+        } else if (!root.remove(last.mKey)) {
+            fail(op, "missing key");
+        }
+        return;
+    }
+    if (!root.contains(nodes.front().mKey)) { fail(op, "missing key"); }
+    auto* parent = &root.at(nodes.front().mKey);
+    for (std::size_t i = 1; i + 1 < nodes.size(); ++i) { parent = &child(*parent, nodes[i], op); }
+    if (last.mKind == NbtPath::Node::Kind::Key) {
+        if (!parent->hold(nbt::Tag::Type::Compound)) { fail(op, "not a compound"); }
+        auto& compound = parent->as<nbt::CompoundTag>();
+        if (op.mKind == Op::Kind::Set) {
+            compound[last.mKey] = op.mValue;
+        } else if (!compound.remove(last.mKey)) {
+            fail(op, "missing key");
+        }
+    } else {
+        if (!parent->hold(nbt::Tag::Type::List)) { fail(op, "not a list"); }
+        auto& list  = parent->as<nbt::ListTag>();
+        auto  index = indexOf(last, list.size(), op);
+        if (op.mKind == Op::Kind::Set) {
+            if (op.mValue.getType() != list.getElementType()) { fail(op, "value type does not match the list element type"); }
+            list[index] = op.mValue;
+        } else {
+            list.remove(index);
+        }
+    }
+}
+
+} // namespace
+
+NbtPatch NbtPatch::diff(nbt::CompoundTag const& from, nbt::CompoundTag const& to) {
+    NbtPatch patch;
+    PatchBuilder(patch.mOps).diffCompound(from, to);
+    return patch;
+}
+
+void NbtPatch::apply(nbt::CompoundTag& target) const {
+    for (auto const& op : mOps) { applyOp(target, op); }
+}
+
+nbt::CompoundTag NbtPatch::toTag() const {
+    auto ops = std::make_unique<nbt::ListTag>();
+    ops->reserve(mOps.size());
+    for (auto const& op : mOps) {
+        auto entry     = std::make_unique<nbt::CompoundTag>();
+        (*entry)["op"] = std::make_unique<nbt::ByteTag>(static_cast<uint8_t>(op.mKind));
+        (*entry)["path"] = std::make_unique<nbt::StringTag>(op.mPath);
+        if (op.mKind != Op::Kind::Remove) { (*entry)["value"] = op.mValue; }
+        if (op.mKind == Op::Kind::Splice) {
+            (*entry)["offset"]  = std::make_unique<nbt::IntTag>(static_cast<int>(op.mOffset));
+            (*entry)["removed"] = std::make_unique<nbt::IntTag>(static_cast<int>(op.mRemoved));
+        }
+        ops->push_back(std::move(entry));
+    }
+    nbt::CompoundTag result;
+    result["ops"] = std::move(ops);
+    return result;
+}
+
+NbtPatch NbtPatch::fromTag(nbt::CompoundTag const& tag) {
+    if (!tag.contains("ops") || !tag.at("ops").hold(nbt::Tag::Type::List)) { throw NbtPatchError("patch tag must contain an \"ops\" list"); }
+    NbtPatch patch;
+    for (auto const& entry : tag.at("ops").as<nbt::ListTag>()) {
+        if (!entry.hold(nbt::Tag::Type::Compound)) { throw NbtPatchError("patch ops must be compounds"); }
+        auto const& op = entry.as<nbt::CompoundTag>();
+        if (!op.contains("op") || !op.at("op").hold(nbt::Tag::Type::Byte) || !op.contains("path") || !op.at("path").hold(nbt::Tag::Type::String)) {
+            throw NbtPatchError("patch op must contain \"op\" (byte) and \"path\" (string)");
+        }
+        auto kind = op.at("op").as<nbt::ByteTag>().storage();
+        if (kind > static_cast<uint8_t>(Op::Kind::Splice)) { throw NbtPatchError(std::format("unknown patch op {}", kind)); }
+        auto& result = patch.mOps.emplace_back(Op{static_cast<Op::Kind>(kind), op.at("path").as<nbt::StringTag>().storage()});
+        if (result.mKind == Op::Kind::Remove) { continue; }
+        if (!op.contains("value")) { throw NbtPatchError(std::format("patch op at \"{}\" is missing its value", result.mPath)); }
+        result.mValue = op.at("value");
+        if (result.mKind == Op::Kind::Splice) {
+            for (auto [key, field] : {std::pair{"offset", &result.mOffset}, std::pair{"removed", &result.mRemoved}}) {
+                if (!op.contains(key) || !op.at(key).hold(nbt::Tag::Type::Int) || op.at(key).as<nbt::IntTag>().storage() < 0) {
+                    throw NbtPatchError(std::format("splice at \"{}\" needs a non-negative int \"{}\"", result.mPath, key));
+                }
+                *field = static_cast<std::size_t>(op.at(key).as<nbt::IntTag>().storage());
+            }
+        }
+    }
+    return patch;
+}
+
+void bindNbtPatch(py::module& m) {
+    auto sm = m.def_submodule("nbt_patch", "Structural diff between CompoundTags");
+
+    py::register_exception<NbtPatchError>(sm, "NbtPatchError", PyExc_ValueError);
+
+    py::class_<NbtPatch>(sm, "NbtPatch")
+        .def_static(
+            "from_tag",
+            &NbtPatch::fromTag,
+            py::arg("tag"),
+            "Read a patch stored with to_tag()\nThrow NbtPatchError (a ValueError) if the tag is not a patch"
+        )
+        .def_static(
+            "from_binary",
+            [](py::buffer data, bool little_endian) {
+                auto                   content = to_cpp_string(data);
+                py::gil_scoped_release release;
+                auto                   tag = nbt::CompoundTag::fromBinaryNbt(content, little_endian);
+                if (!tag) { throw NbtPatchError("invalid binary nbt"); }
+                return NbtPatch::fromTag(*tag);
+            },
+            py::arg("data"),
+            py::arg("little_endian") = true,
+            "Read a patch serialized with to_binary()\nThrow NbtPatchError (a ValueError) if the data is not a patch"
+        )
+        .def("to_tag", &NbtPatch::toTag, "Store the patch as a CompoundTag {ops: [{op, path, value, offset, removed}, ...]}")
+        .def(
+            "to_binary",
+            [](NbtPatch const& self, bool little_endian) {
+                std::string content;
+                {
+                    py::gil_scoped_release release;
+                    content = self.toTag().toBinaryNbt(little_endian);
+                }
+                return to_py_bytes(content);
+            },
+            py::arg("little_endian") = true,
+            "Serialize the patch to binary NBT"
+        )
+        .def(
+            "operations",
+            [](NbtPatch const& self) {
+                static constexpr std::string_view names[] = {"set", "remove", "splice"};
+                py::list                          result;
+                for (auto const& op : self.ops()) {
+                    if (op.mKind == NbtPatch::Op::Kind::Remove) {
+                        result.append(py::make_tuple(names[1], op.mPath));
+                    } else if (op.mKind == NbtPatch::Op::Kind::Set) {
+                        result.append(py::make_tuple(names[0], op.mPath, op.mValue));
+                    } else {
+                        result.append(py::make_tuple(names[2], op.mPath, op.mValue, op.mOffset, op.mRemoved));
+                    }
+                }
+                return result;
+            },
+            "Get the edits as tuples\nReturns:\n    list of (\"set\", path, value), (\"remove\", path) and (\"splice\", path, elements, offset, removed)"
+        )
+        .def("__len__", [](NbtPatch const& self) { return self.ops().size(); }, "Number of edits")
+        .def(
+            "__repr__",
+            [](NbtPatch const& self) { return std::format("<rapidnbt.NbtPatch(ops={0}) object at 0x{1:0{2}X}>", self.ops().size(), ADDRESS); },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,55 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <nbt/NBT.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace rapidnbt {
+
+class NbtPatchError : public std::invalid_argument {
+public:
+    using std::invalid_argument::invalid_argument;
+};
+
+// Edits turning one CompoundTag into another, addressed by NbtPath strings made of keys and indices
+class NbtPatch {
+public:
+    struct Op {
+        enum class Kind : uint8_t {
+            Set,    // replace or add the tag at mPath with mValue
+            Remove, // remove the key or list element at mPath
+            Splice, // replace mRemoved elements from mOffset of the array or list at mPath with the elements of mValue
+        };
+
+        Kind                    mKind;
+        std::string             mPath;
+        nbt::CompoundTagVariant mValue{};
+        std::size_t             mOffset{};
+        std::size_t             mRemoved{};
+    };
+
+    // Edits from `from` to `to`, unchanged subtrees produce no ops
+    static NbtPatch diff(nbt::CompoundTag const& from, nbt::CompoundTag const& to);
+
+    // Apply the ops in order, throw NbtPatchError (or NbtPathError) if the tag does not have the shape the patch expects
+    // The ops before the failing one stay applied
+    void apply(nbt::CompoundTag& target) const;
+
+    std::vector<Op> const& ops() const noexcept { return mOps; }
+
+    // {ops: [{op: 0b (set) / 1b (remove) / 2b (splice), path: "...", value: ..., offset: ..., removed: ...}, ...]}
+    nbt::CompoundTag toTag() const;
+    static NbtPatch  fromTag(nbt::CompoundTag const& tag);
+
+private:
+    std::vector<Op> mOps;
+};
+
+} // namespace rapidnbt
@@ -0,0 +1,395 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "NbtPath.hpp"
+#include "NativeModule.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace rapidnbt {
+
+namespace {
+
+[[noreturn]] void fail(std::size_t position, std::string_view reason) { throw NbtPathError(std::format("invalid nbt path at position {}: {}", position, reason)); }
+
+bool isKeyChar(char ch) noexcept {
+    switch (ch) {
+    case '.':
+    case '[':
+    case ']':
+    case '{':
+    case '}':
+    case '"':
+    case '\'':
+    case ' ':
+    case '\t':
+    case '\n':
+        return false;
+    default:
+        return true;
+    }
+}
+
+class PathParser {
+public:
+    explicit PathParser(std::string_view text) : mText(text) {}
+
+    std::vector<NbtPath::Node> parse() {
+        std::vector<NbtPath::Node> nodes;
+        if (peek() == '{') {
+            nodes.push_back({NbtPath::Node::Kind::Filter, {}, 0, parseCompound()});
+            if (peek() == '.') { ++mPos; }
+        }
+        while (mPos < mText.size()) {
+            nodes.push_back({NbtPath::Node::Kind::Key, parseKey()});
+            while (peek() == '[' || peek() == '{') {
+                if (peek() == '{') {
+                    nodes.push_back({NbtPath::Node::Kind::Filter, {}, 0, parseCompound()});
+                } else {
+                    nodes.push_back(parseBracket());
+                }
+            }
+            if (mPos == mText.size()) { break; }
+            if (peek() != '.') { fail(mPos, std::format("unexpected '{}'", mText[mPos])); }
+            if (++mPos == mText.size()) { fail(mPos, "expected a key after '.'"); }
+        }
+        return nodes;
+    }
+
+private:
+    char peek() const noexcept { return mPos < mText.size() ? mText[mPos] : '\0'; }
+
+    std::string parseKey() {
+        auto quote = peek();
+        if (quote == '"' || quote == '\'') {
+            auto        begin = mPos++;
+            std::string key;
+            while (mPos < mText.size() && mText[mPos] != quote) {
+                if (mText[mPos] == '\\' && mPos + 1 < mText.size()) { ++mPos; }
+                key.push_back(mText[mPos++]);
+            }
+            if (mPos == mText.size()) { fail(begin, "unterminated quoted key"); }
+            ++mPos;
+            return key;
+        }
+        auto begin = mPos;
+        while (mPos < mText.size() && isKeyChar(mText[mPos])) { ++mPos; }
+        if (mPos == begin) { fail(mPos, "expected a key"); }
+        return std::string(mText.substr(begin, mPos - begin));
+    }
+
+    // Find the brace closing the compound at mPos, skipping over nested tags and quoted strings
+    std::size_t findCompoundEnd() const {
+        std::size_t depth = 0;
+        for (auto pos = mPos; pos < mText.size(); ++pos) {
+            auto ch = mText[pos];
+            if (ch == '"' || ch == '\'') {
+                for (++pos; pos < mText.size() && mText[pos] != ch; ++pos) {
+                    if (mText[pos] == '\\') { ++pos; }
+                }
+            } else if (ch == '{' || ch == '[') {
+                ++depth;
+            } else if ((ch == '}' || ch == ']') && --depth == 0) {
+                return pos + 1;
+            }
+        }
+        fail(mPos, "unterminated compound");
+    }
+
+    std::shared_ptr<nbt::CompoundTag const> parseCompound() {
+        auto end     = findCompoundEnd();
+        auto pattern = nbt::CompoundTag::fromSnbt(mText.substr(mPos, end - mPos));
+        if (!pattern) { fail(mPos, "invalid compound"); }
+        mPos = end;
+        return std::make_shared<nbt::CompoundTag const>(std::move(*pattern));
+    }
+
+    NbtPath::Node parseBracket() {
+        auto begin = mPos++;
+        if (peek() == ']') {
+            ++mPos;
+            return {NbtPath::Node::Kind::AllElements};
+        }
+        NbtPath::Node node{NbtPath::Node::Kind::Index};
+        if (peek() == '{') {
+            node = {NbtPath::Node::Kind::ElementFilter, {}, 0, parseCompound()};
+        } else {
+            auto [ptr, error] = std::from_chars(mText.data() + mPos, mText.data() + mText.size(), node.mIndex);
+            if (error != std::errc{}) { fail(mPos, "expected an index"); }
+            mPos = static_cast<std::size_t>(ptr - mText.data());
+        }
+        if (peek() != ']') { fail(begin, "unterminated '['"); }
+        ++mPos;
+        return node;
+    }
+
+    std::string_view mText;
+    std::size_t      mPos{0};
+};
+
+bool matchesValue(nbt::CompoundTagVariant const& pattern, nbt::CompoundTagVariant const& value) {
+    if (pattern.hold(nbt::Tag::Type::Compound)) {
+        return value.hold(nbt::Tag::Type::Compound) && matchesPattern(pattern.as<nbt::CompoundTag>(), value.as<nbt::CompoundTag>());
+    }
+    if (pattern.hold(nbt::Tag::Type::List)) {
+        if (!value.hold(nbt::Tag::Type::List)) { return false; }
+        auto const& expected = pattern.as<nbt::ListTag>();
+        auto const& actual   = value.as<nbt::ListTag>();
+        // as in the /data command, an empty list only matches an empty list and every other pattern element must match some element
+        if (expected.size() == 0) { return actual.size() == 0; }
+        return std::ranges::all_of(expected, [&](auto const& element) {
+            return std::ranges::any_of(actual, [&](auto const& candidate) { return matchesValue(element, candidate); });
+        });
+    }
+    return pattern == value;
+}
+
+nbt::CompoundTag* compoundOf(NbtPathMatch const& match) noexcept {
+    if (auto root = std::get_if<nbt::CompoundTag*>(&match)) { return *root; }
+    if (auto tag = std::get_if<nbt::CompoundTagVariant*>(&match); tag && (*tag)->hold(nbt::Tag::Type::Compound)) { return &(*tag)->as<nbt::CompoundTag>(); }
+    return nullptr;
+}
+
+template <typename Visitor>
+void forEachElement(NbtPathMatch const& match, Visitor&& visitor) {
+    auto tag = std::get_if<nbt::CompoundTagVariant*>(&match);
+    if (!tag) { return; }
+    auto& value = **tag;
+    switch (value.getType()) {
+    case nbt::Tag::Type::List:
+        for (auto& element : value.as<nbt::ListTag>()) { visitor(NbtPathMatch{&element}); }
+        break;
+    case nbt::Tag::Type::ByteArray:
+        for (auto element : value.as<nbt::ByteArrayTag>().storage()) { visitor(NbtPathMatch{static_cast<int64_t>(static_cast<uint8_t>(element))}); }
+        break;
+    case nbt::Tag::Type::IntArray:
+        for (auto element : value.as<nbt::IntArrayTag>().storage()) { visitor(NbtPathMatch{static_cast<int64_t>(element)}); }
+        break;
+    case nbt::Tag::Type::LongArray:
+        for (auto element : value.as<nbt::LongArrayTag>().storage()) { visitor(NbtPathMatch{static_cast<int64_t>(element)}); }
+        break;
+    default:
+        break;
+    }
+}
+
+std::optional<NbtPathMatch> elementAt(NbtPathMatch const& match, int64_t index) {
+    auto tag = std::get_if<nbt::CompoundTagVariant*>(&match);
+    if (!tag) { return std::nullopt; }
+    auto& value = **tag;
+    auto  at    = [&](auto& storage) -> std::optional<std::size_t> {
+        auto size     = static_cast<int64_t>(storage.size());
+        auto position = index < 0 ? size + index : index;
+        if (position < 0 || position >= size) { return std::nullopt; }
+        return static_cast<std::size_t>(position);
+    };
+    switch (value.getType()) {
+    case nbt::Tag::Type::List: {
+        auto& list     = value.as<nbt::ListTag>();
+        auto  position = at(list);
+        if (!position) { return std::nullopt; }
+        return NbtPathMatch{&list[*position]};
+    }
+    case nbt::Tag::Type::ByteArray: {
+        auto& storage  = value.as<nbt::ByteArrayTag>().storage();
+        auto  position = at(storage);
+        if (!position) { return std::nullopt; }
+        return NbtPathMatch{static_cast<int64_t>(static_cast<uint8_t>(storage[*position]))};
+    }
+    case nbt::Tag::Type::IntArray: {
+        auto& storage  = value.as<nbt::IntArrayTag>().storage();
+        auto  position = at(storage);
+        if (!position) { return std::nullopt; }
+        return NbtPathMatch{static_cast<int64_t>(storage[*position])};
+    }
+    case nbt::Tag::Type::LongArray: {
+        auto& storage  = value.as<nbt::LongArrayTag>().storage();
+        auto  position = at(storage);
+        if (!position) { return std::nullopt; }
+        return NbtPathMatch{static_cast<int64_t>(storage[*position])};
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+// Apply the nodes to root, child(entry, match) makes the entry for a match reached from entry
+template <typename Entry, typename MatchOf, typename Child>
+std::vector<Entry> evaluateNodes(std::vector<NbtPath::Node> const& nodes, Entry root, MatchOf&& matchOf, Child&& child) {
+    std::vector<Entry> current{root};
+    std::vector<Entry> next;
+    for (auto const& node : nodes) {
+        next.clear();
+        for (auto const& entry : current) {
+            auto match = matchOf(entry);
+            switch (node.mKind) {
+            case NbtPath::Node::Kind::Key:
+                if (auto compound = compoundOf(match); compound && compound->contains(node.mKey)) {
+                    next.push_back(child(entry, NbtPathMatch{&compound->at(node.mKey)}));
+                }
+                break;
+            case NbtPath::Node::Kind::Filter:
+                if (auto compound = compoundOf(match); compound && matchesPattern(*node.mPattern, *compound)) { next.push_back(entry); }
+                break;
+            case NbtPath::Node::Kind::AllElements:
+                forEachElement(match, [&](NbtPathMatch element) { next.push_back(child(entry, element)); });
+                break;
+            case NbtPath::Node::Kind::Index:
+                if (auto element = elementAt(match, node.mIndex)) { next.push_back(child(entry, *element)); }
+                break;
+            case NbtPath::Node::Kind::ElementFilter:
+                forEachElement(match, [&](NbtPathMatch element) {
+                    if (auto compound = compoundOf(element); compound && matchesPattern(*node.mPattern, *compound)) { next.push_back(child(entry, element)); }
+                });
+                break;
+            }
+        }
+        std::swap(current, next);
+        if (current.empty()) { break; }
+    }
+    return current;
+}
+
+} // namespace
+
+bool matchesPattern(nbt::CompoundTag const& pattern, nbt::CompoundTag const& value) {
+    for (auto const& [key, expected] : pattern) {
+        if (!value.contains(key) || !matchesValue(expected, value.at(key))) { return false; }
+    }
+    return true;
+}
+
+NbtPath NbtPath::parse(std::string_view text) {
+    NbtPath path;
+    path.mText  = text;
+    path.mNodes = PathParser(text).parse();
+    return path;
+}
+
+std::vector<NbtPathMatch> NbtPath::evaluate(nbt::CompoundTag& root) const {
+    return evaluateNodes(
+        mNodes,
+        NbtPathMatch{&root},
+        [](NbtPathMatch const& match) { return match; },
+        [](NbtPathMatch const&, NbtPathMatch element) { return element; }
+    );
+}
+
+std::optional<NbtPathMatch> NbtPath::first(nbt::CompoundTag& root) const {
+    auto matches = evaluate(root);
+    if (matches.empty()) { return std::nullopt; }
+    return matches.front();
+}
+
+std::vector<std::vector<NbtPathMatch>> NbtPath::trace(nbt::CompoundTag& root) const {
+    // Every match reached on the way with the index of the one it was reached from
+    std::vector<std::pair<NbtPathMatch, std::size_t>> steps{{&root, 0}};
+
+    auto ends = evaluateNodes(
+        mNodes,
+        std::size_t{0},
+        [&steps](std::size_t index) { return steps[index].first; },
+        [&steps](std::size_t from, NbtPathMatch element) {
+            steps.emplace_back(element, from);
+            return steps.size() - 1;
+        }
+    );
+    std::vector<std::vector<NbtPathMatch>> result;
+    result.reserve(ends.size());
+    for (auto index : ends) {
+        auto& trace = result.emplace_back();
+        for (; index != 0; index = steps[index].second) { trace.push_back(steps[index].first); }
+        trace.push_back(&root);
+        std::ranges::reverse(trace);
+    }
+    return result;
+}
+
+std::string quotePathKey(std::string_view key) {
+    if (!key.empty() && std::ranges::all_of(key, isKeyChar)) { return std::string(key); }
+    std::string result("\"");
+    for (auto ch : key) {
+        if (ch == '"' || ch == '\\') { result.push_back('\\'); }
+        result.push_back(ch);
+    }
+    result.push_back('"');
+    return result;
+}
+
+py::object to_py_path_match(std::vector<NbtPathMatch> const& trace, py::handle root) {
+    // Each tag is kept alive by the one it was reached through, as with chained [] lookups
+    auto result = py::reinterpret_borrow<py::object>(root);
+    for (auto const& match : trace) {
+        if (auto tag = std::get_if<nbt::CompoundTagVariant*>(&match)) {
+            result = py::cast(*tag, py::return_value_policy::reference_internal, result);
+        } else if (auto element = std::get_if<int64_t>(&match)) {
+            return py::int_(*element);
+        }
+    }
+    return result;
+}
+
+void bindNbtPath(py::module& m) {
+    auto sm = m.def_submodule("nbt_path", "Compiled NBT path in the syntax of the Java Edition /data command");
+
+    py::register_exception<NbtPathError>(sm, "NbtPathError", PyExc_ValueError);
+
+    py::class_<NbtPath>(sm, "NbtPath")
+        .def(
+            py::init(&NbtPath::parse),
+            py::arg("path"),
+            "Compile a path\nExample:\n    NbtPath(\"Items[{Slot:3b}].tag.display.Name\")\n    NbtPath(\"Level.Sections[].Y\")\nThrow NbtPathError (a "
+            "ValueError) if the path is malformed"
+        )
+        .def(
+            "query",
+            [](NbtPath const& self, py::object const& nbt) -> py::object {
+                auto traces = self.trace(nbt.cast<nbt::CompoundTag&>());
+                return traces.empty() ? py::none() : to_py_path_match(traces.front(), nbt);
+            },
+            py::arg("nbt"),
+            "Get the first tag matched by the path\nArray elements are returned as int\nReturns:\n    CompoundTagVariant, CompoundTag (empty path), int "
+            "or None if nothing matches"
+        )
+        .def(
+            "query_all",
+            [](NbtPath const& self, py::object const& nbt) {
+                py::list result;
+                for (auto const& trace : self.trace(nbt.cast<nbt::CompoundTag&>())) { result.append(to_py_path_match(trace, nbt)); }
+                return result;
+            },
+            py::arg("nbt"),
+            "Get every tag matched by the path\nReturns:\n    list of CompoundTagVariant, CompoundTag (empty path) or int"
+        )
+        .def(
+            "query_each",
+            [](NbtPath const& self, std::vector<py::object> const& tags) {
+                std::vector<nbt::CompoundTag*> roots;
+                roots.reserve(tags.size());
+                for (auto const& tag : tags) { roots.push_back(&tag.cast<nbt::CompoundTag&>()); }
+                std::vector<std::vector<std::vector<NbtPathMatch>>> traces(roots.size());
+                {
+                    py::gil_scoped_release release;
+                    for (std::size_t i = 0; i < roots.size(); ++i) { traces[i] = self.trace(*roots[i]); }
+                }
+                py::list result(tags.size());
+                for (std::size_t i = 0; i < tags.size(); ++i) { result[i] = traces[i].empty() ? py::none() : to_py_path_match(traces[i].front(), tags[i]); }
+                return result;
+            },
+            py::arg("tags"),
+            "Get the first tag matched by the path in each of many tags in one call\nReturns:\n    list of matches (None where nothing matches) in input "
+            "order"
+        )
+        .def("__str__", &NbtPath::text, "The path text")
+        .def(
+            "__repr__",
+            [](NbtPath const& self) { return std::format("<rapidnbt.NbtPath({0}) object at 0x{1:0{2}X}>", self.text(), ADDRESS); },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,69 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <memory>
+#include <nbt/NBT.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace rapidnbt {
+
+class NbtPathError : public std::invalid_argument {
+public:
+    using std::invalid_argument::invalid_argument;
+};
+
+// A tag reached by a path: the root compound, a tag inside it, or an element of a byte/int/long array
+using NbtPathMatch = std::variant<nbt::CompoundTag*, nbt::CompoundTagVariant*, int64_t>;
+
+// Compiled NBT path in the syntax of the Java Edition /data command, e.g. Items[{Slot:3b}].tag.display.Name
+class NbtPath {
+public:
+    struct Node {
+        enum class Kind {
+            Key,           // name
+            Filter,        // {snbt}, keep the current tag if it is a compound containing the pattern
+            AllElements,   // []
+            Index,         // [index], negative indices count from the end
+            ElementFilter, // [{snbt}], compound elements containing the pattern
+        };
+
+        Kind                                    mKind;
+        std::string                             mKey{};
+        int64_t                                 mIndex{};
+        std::shared_ptr<nbt::CompoundTag const> mPattern{};
+    };
+
+    // Throw NbtPathError if the path is malformed
+    static NbtPath parse(std::string_view text);
+
+    std::string const&       text() const noexcept { return mText; }
+    std::vector<Node> const& nodes() const noexcept { return mNodes; }
+
+    std::vector<NbtPathMatch>   evaluate(nbt::CompoundTag& root) const;
+    std::optional<NbtPathMatch> first(nbt::CompoundTag& root) const;
+
+    // Matches of evaluate with the tags they were reached through, each trace runs from root to the match
+    std::vector<std::vector<NbtPathMatch>> trace(nbt::CompoundTag& root) const;
+
+private:
+    std::string       mText;
+    std::vector<Node> mNodes;
+};
+
+// Key as written in a path, quoted when it is empty or contains characters that end an unquoted key
+std::string quotePathKey(std::string_view key);
+
+// Check that every key of the pattern is present in the value with an equal (or, for compounds and lists, matching) tag
+bool matchesPattern(nbt::CompoundTag const& pattern, nbt::CompoundTag const& value);
+
+} // namespace rapidnbt
@@ -0,0 +1,74 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "NbtProjection.hpp"
+#include "Compression.hpp"
+
+namespace rapidnbt {
+
+NbtProjection::NbtProjection(std::vector<NbtPath> const& paths) {
+    for (auto const& path : paths) {
+        auto* node = &mRoot;
+        for (auto const& step : path.nodes()) {
+            if (step.mKind != NbtPath::Node::Kind::Key) { throw NbtPathError("projection paths may only contain keys: " + path.text()); }
+            node = &node->mChildren[step.mKey];
+        }
+        node->mWhole = true;
+    }
+}
+
+void NbtProjection::project(NbtReader& reader, Node const& node, std::string& output) {
+    auto content = reader.data();
+    for (auto type = reader.readType(); type != nbt::Tag::Type::End; type = reader.readType()) {
+        auto begin = reader.position() - 1;
+        auto child = node.mChildren.find(reader.readString());
+        if (child == node.mChildren.end() || (!child->second.mWhole && type != nbt::Tag::Type::Compound)) {
+            reader.skipPayload(type);
+        } else if (child->second.mWhole) {
+            // copy the encoded tag as is, the nbt parser builds it later
+            reader.skipPayload(type);
+            output.append(content.substr(begin, reader.position() - begin));
+        } else {
+            auto mark = output.size();
+            output.append(content.substr(begin, reader.position() - begin));
+            auto written = output.size();
+            project(reader, child->second, output);
+            // drop compounds none of whose projected keys exist
+            if (output.size() == written) {
+                output.resize(mark);
+            } else {
+                output.push_back(static_cast<char>(nbt::Tag::Type::End));
+            }
+        }
+    }
+}
+
+std::optional<nbt::CompoundTag> NbtProjection::parse(std::string_view content, std::optional<nbt::NbtFileFormat> format, bool strictMatchSize) const {
+    std::optional<ByteBuffer> inflated;
+    if (detectCompression(content) != nbt::NbtCompressionType::None) {
+        inflated = decompress(content);
+        if (!inflated) { return std::nullopt; }
+        content = inflated->view();
+    }
+    if (!format) { format = nbt::io::detectContentFormat(content, strictMatchSize); }
+    if (!format) { return std::nullopt; }
+    try {
+        auto        encoding = encodingOf(*format);
+        NbtReader   reader(content, encoding, headerSizeOf(*format));
+        auto        begin = reader.position();
+        std::string output;
+        if (reader.readType() != nbt::Tag::Type::Compound) { return std::nullopt; }
+        reader.readString();
+        output.append(content.substr(begin, reader.position() - begin));
+        project(reader, mRoot, output);
+        output.push_back(static_cast<char>(nbt::Tag::Type::End));
+        if (strictMatchSize && reader.position() != content.size()) { return std::nullopt; }
+        return nbt::io::parseFromContent(output, payloadFormatOf(encoding), true);
+    } catch (NbtFormatError const&) { return std::nullopt; }
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,37 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "NbtPath.hpp"
+#include "NbtReader.hpp"
+#include <map>
+
+namespace rapidnbt {
+
+// Set of key paths to keep when parsing, e.g. {"Data.Player", "Data.LevelName"}
+// Everything else is skipped over by its encoded length, so unused subtrees never allocate tags
+class NbtProjection {
+public:
+    // Throw NbtPathError if a path contains anything but keys
+    explicit NbtProjection(std::vector<NbtPath> const& paths);
+
+    // Parse (and inflate if compressed) content keeping only the projected keys, nullopt if parsing fails
+    std::optional<nbt::CompoundTag> parse(std::string_view content, std::optional<nbt::NbtFileFormat> format, bool strictMatchSize) const;
+
+private:
+    // A node without children keeps its whole subtree
+    struct Node {
+        std::map<std::string, Node, std::less<>> mChildren;
+        bool                                     mWhole{false};
+    };
+
+    static void project(NbtReader& reader, Node const& node, std::string& output);
+
+    Node mRoot;
+};
+
+} // namespace rapidnbt
@@ -0,0 +1,376 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "ByteSource.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <nbt/NBT.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace rapidnbt {
+
+enum class NbtEncoding { LittleEndian, BigEndian, Network };
+
+class NbtFormatError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// The content ended in the middle of a tag
+class NbtTruncatedError : public NbtFormatError {
+public:
+    NbtTruncatedError() : NbtFormatError("unexpected end of nbt content") {}
+};
+
+constexpr std::size_t MAX_NBT_DEPTH = 512;
+
+inline NbtEncoding encodingOf(nbt::NbtFileFormat format) {
+    switch (format) {
+    case nbt::NbtFileFormat::BigEndian:
+    case nbt::NbtFileFormat::BigEndianWithHeader:
+        return NbtEncoding::BigEndian;
+    case nbt::NbtFileFormat::BedrockNetwork:
+        return NbtEncoding::Network;
+    default:
+        return NbtEncoding::LittleEndian;
+    }
+}
+
+// Format of a bare payload in the given encoding, without the header
+inline nbt::NbtFileFormat payloadFormatOf(NbtEncoding encoding) {
+    switch (encoding) {
+    case NbtEncoding::BigEndian:
+        return nbt::NbtFileFormat::BigEndian;
+    case NbtEncoding::Network:
+        return nbt::NbtFileFormat::BedrockNetwork;
+    default:
+        return nbt::NbtFileFormat::LittleEndian;
+    }
+}
+
+// Storage version + content length written before the root tag
+inline std::size_t headerSizeOf(nbt::NbtFileFormat format) {
+    return format == nbt::NbtFileFormat::LittleEndianWithHeader || format == nbt::NbtFileFormat::BigEndianWithHeader ? 8 : 0;
+}
+
+// Input over a contiguous buffer, every byte stays addressable
+class MemoryInput {
+public:
+    MemoryInput(std::string_view data, std::size_t position) noexcept : mData(data), mPosition(position) {}
+
+    std::string_view data() const noexcept { return mData; }
+    std::size_t      position() const noexcept { return mPosition; }
+    std::size_t      remaining() const noexcept { return mData.size() - mPosition; }
+    void             seek(std::size_t position) noexcept { mPosition = position; }
+
+    const char* take(std::size_t size) {
+        if (remaining() < size) { throw NbtTruncatedError(); }
+        auto* result  = mData.data() + mPosition;
+        mPosition    += size;
+        return result;
+    }
+
+    void skip(std::size_t size) { take(size); }
+
+private:
+    std::string_view mData;
+    std::size_t      mPosition;
+};
+
+// Input over a ByteSource through a sliding window, taken bytes stay valid until the next take
+class StreamInput {
+public:
+    explicit StreamInput(ByteSource& source, std::size_t chunkSize = 1u << 16) : mSource(source), mChunkSize(chunkSize) {}
+
+    std::size_t position() const noexcept { return mPosition; }
+
+    const char* take(std::size_t size) {
+        if (mEnd - mBegin < size) { fill(size); }
+        auto* result  = mWindow.data() + mBegin;
+        mBegin       += size;
+        mPosition    += size;
+        return result;
+    }
+
+    void skip(std::size_t size) {
+        while (size > 0) {
+            if (mBegin == mEnd) { fill(1); }
+            auto count  = std::min(size, mEnd - mBegin);
+            mBegin     += count;
+            mPosition  += count;
+            size       -= count;
+        }
+    }
+
+    // Whether the source has been fully consumed
+    bool exhausted() {
+        if (mBegin != mEnd) { return false; }
+        mBegin = mEnd = 0;
+        if (mWindow.empty()) { mWindow.resize(mChunkSize); }
+        mEnd = mSource.read(mWindow.data(), mWindow.size());
+        return mEnd == 0;
+    }
+
+private:
+    void fill(std::size_t size) {
+        std::copy(mWindow.begin() + static_cast<std::ptrdiff_t>(mBegin), mWindow.begin() + static_cast<std::ptrdiff_t>(mEnd), mWindow.begin());
+        mEnd   -= mBegin;
+        mBegin  = 0;
+        if (mWindow.size() < std::max(size, mChunkSize)) { mWindow.resize(std::max(size, mChunkSize)); }
+        while (mEnd < size) {
+            auto count = mSource.read(mWindow.data() + mEnd, mWindow.size() - mEnd);
+            if (count == 0) { throw NbtTruncatedError(); }
+            mEnd += count;
+        }
+    }
+
+    ByteSource& mSource;
+    std::size_t mChunkSize;
+    std::string mWindow{};
+    std::size_t mBegin{0};
+    std::size_t mEnd{0};
+    std::size_t mPosition{0};
+};
+
+// Bounds checked cursor over binary NBT which reads and skips payloads without building any tag
+template <typename Input>
+class BasicNbtReader {
+public:
+    BasicNbtReader(Input input, NbtEncoding encoding) noexcept : mInput(std::move(input)), mEncoding(encoding) {}
+
+    Input&       input() noexcept { return mInput; }
+    Input const& input() const noexcept { return mInput; }
+    NbtEncoding  encoding() const noexcept { return mEncoding; }
+    std::size_t  position() const noexcept { return mInput.position(); }
+
+    uint8_t readByte() { return static_cast<uint8_t>(*mInput.take(1)); }
+
+    nbt::Tag::Type readType() {
+        auto type = readByte();
+        if (type > static_cast<uint8_t>(nbt::Tag::Type::LongArray)) { throw NbtFormatError("invalid tag type"); }
+        return static_cast<nbt::Tag::Type>(type);
+    }
+
+    int16_t readShort() { return mEncoding == NbtEncoding::BigEndian ? readFixed<int16_t, std::endian::big>() : readFixed<int16_t, std::endian::little>(); }
+
+    int32_t readInt() {
+        switch (mEncoding) {
+        case NbtEncoding::BigEndian:
+            return readFixed<int32_t, std::endian::big>();
+        case NbtEncoding::Network:
+            return static_cast<int32_t>(zigzag(readVarUInt(5)));
+        default:
+            return readFixed<int32_t, std::endian::little>();
+        }
+    }
+
+    int64_t readLong() {
+        switch (mEncoding) {
+        case NbtEncoding::BigEndian:
+            return readFixed<int64_t, std::endian::big>();
+        case NbtEncoding::Network:
+            return zigzag(readVarUInt(10));
+        default:
+            return readFixed<int64_t, std::endian::little>();
+        }
+    }
+
+    float readFloat() { return std::bit_cast<float>(readFloatBits<uint32_t>()); }
+
+    double readDouble() { return std::bit_cast<double>(readFloatBits<uint64_t>()); }
+
+    // The returned view is only valid until the next read on streamed inputs
+    std::string_view readString() {
+        std::size_t length;
+        switch (mEncoding) {
+        case NbtEncoding::BigEndian:
+            length = readFixed<uint16_t, std::endian::big>();
+            break;
+        case NbtEncoding::Network:
+            length = static_cast<std::size_t>(readVarUInt(5));
+            break;
+        default:
+            length = readFixed<uint16_t, std::endian::little>();
+        }
+        return {mInput.take(length), length};
+    }
+
+    std::string_view readBytes(std::size_t size) { return {mInput.take(size), size}; }
+
+    // Element count of lists and arrays
+    std::size_t readLength() {
+        auto length = readInt();
+        if (length < 0) { return 0; }
+        return static_cast<std::size_t>(length);
+    }
+
+    void skip(std::size_t size) { mInput.skip(size); }
+
+    void skipPayload(nbt::Tag::Type type, std::size_t depth = 0) {
+        if (depth > MAX_NBT_DEPTH) { throw NbtFormatError("nbt nesting too deep"); }
+        switch (type) {
+        case nbt::Tag::Type::End:
+            return;
+        case nbt::Tag::Type::Byte:
+            return skip(1);
+        case nbt::Tag::Type::Short:
+            return skip(2);
+        case nbt::Tag::Type::Int:
+            return mEncoding == NbtEncoding::Network ? skipVarInt(5) : skip(4);
+        case nbt::Tag::Type::Long:
+            return mEncoding == NbtEncoding::Network ? skipVarInt(10) : skip(8);
+        case nbt::Tag::Type::Float:
+            return skip(4);
+        case nbt::Tag::Type::Double:
+            return skip(8);
+        case nbt::Tag::Type::ByteArray:
+            return skip(readLength());
+        case nbt::Tag::Type::String:
+            readString();
+            return;
+        case nbt::Tag::Type::List: {
+            auto elementType = readType();
+            auto count       = readLength();
+            if (auto fixed = fixedSizeOf(elementType)) { return skipElements(count, fixed); }
+            for (std::size_t i = 0; i < count; ++i) { skipPayload(elementType, depth + 1); }
+            return;
+        }
+        case nbt::Tag::Type::Compound:
+            for (auto childType = readType(); childType != nbt::Tag::Type::End; childType = readType()) {
+                readString();
+                skipPayload(childType, depth + 1);
+            }
+            return;
+        case nbt::Tag::Type::IntArray:
+        case nbt::Tag::Type::LongArray: {
+            auto count = readLength();
+            auto width = type == nbt::Tag::Type::IntArray ? 4u : 8u;
+            if (mEncoding != NbtEncoding::Network) { return skipElements(count, width); }
+            for (std::size_t i = 0; i < count; ++i) { skipVarInt(width == 4 ? 5 : 10); }
+            return;
+        }
+        }
+        throw NbtFormatError("invalid tag type");
+    }
+
+    // Encoded size of payloads which do not depend on their content, 0 if variable
+    std::size_t fixedSizeOf(nbt::Tag::Type type) const noexcept {
+        switch (type) {
+        case nbt::Tag::Type::Byte:
+            return 1;
+        case nbt::Tag::Type::Short:
+            return 2;
+        case nbt::Tag::Type::Int:
+            return mEncoding == NbtEncoding::Network ? 0 : 4;
+        case nbt::Tag::Type::Long:
+            return mEncoding == NbtEncoding::Network ? 0 : 8;
+        case nbt::Tag::Type::Float:
+            return 4;
+        case nbt::Tag::Type::Double:
+            return 8;
+        default:
+            return 0;
+        }
+    }
+
+private:
+    template <typename T, std::endian Order>
+    T readFixed() {
+        T value;
+        std::memcpy(&value, mInput.take(sizeof(T)), sizeof(T));
+        if constexpr (Order != std::endian::native) { value = std::byteswap(value); }
+        return value;
+    }
+
+    template <typename T>
+    T readFloatBits() {
+        // floating point numbers are little-endian in network nbt as well
+        return mEncoding == NbtEncoding::BigEndian ? readFixed<T, std::endian::big>() : readFixed<T, std::endian::little>();
+    }
+
+    uint64_t readVarUInt(std::size_t maxBytes) {
+        uint64_t result = 0;
+        for (std::size_t i = 0; i < maxBytes; ++i) {
+            auto byte  = readByte();
+            result    |= static_cast<uint64_t>(byte & 0x7F) << (7 * i);
+            if (!(byte & 0x80)) { return result; }
+        }
+        throw NbtFormatError("varint too long");
+    }
+
+    void skipVarInt(std::size_t maxBytes) { readVarUInt(maxBytes); }
+
+    void skipElements(std::size_t count, std::size_t width) {
+        if (count > SIZE_MAX / width) { throw NbtTruncatedError(); }
+        skip(count * width);
+    }
+
+    static int64_t zigzag(uint64_t value) noexcept { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+    Input       mInput;
+    NbtEncoding mEncoding;
+};
+
+class NbtReader : public BasicNbtReader<MemoryInput> {
+public:
+    NbtReader(std::string_view data, NbtEncoding encoding, std::size_t position = 0) noexcept
+    : BasicNbtReader(MemoryInput(data, position), encoding) {}
+
+    std::string_view data() const noexcept { return input().data(); }
+    std::size_t      remaining() const noexcept { return input().remaining(); }
+    void             seek(std::size_t position) noexcept { input().seek(position); }
+};
+
+using NbtStreamReader = BasicNbtReader<StreamInput>;
+
+// Guess the format from the beginning of uncompressed content by walking it with every encoding
+// Complete content picks the first format that walks it exactly. An incomplete prefix only picks a format when it is the one
+// walk cut off by the end of the prefix, the others having hit a malformed tag or ended the root before the content ends. If
+// several were cut off, `ambiguous` is set and the caller should retry with more input
+inline std::optional<nbt::NbtFileFormat> guessFormat(std::string_view prefix, bool complete, bool& ambiguous) {
+    std::optional<nbt::NbtFileFormat> result;
+    std::optional<nbt::NbtFileFormat> trailing;
+    std::size_t                       candidates = 0;
+    for (auto format : {
+             nbt::NbtFileFormat::LittleEndian,
+             nbt::NbtFileFormat::BigEndian,
+             nbt::NbtFileFormat::BedrockNetwork,
+             nbt::NbtFileFormat::LittleEndianWithHeader,
+             nbt::NbtFileFormat::BigEndianWithHeader
+         }) {
+        NbtReader reader(prefix, encodingOf(format), 0);
+        try {
+            reader.skip(headerSizeOf(format));
+            if (reader.readType() != nbt::Tag::Type::Compound) { continue; }
+            reader.readString();
+            reader.skipPayload(nbt::Tag::Type::Compound);
+            if (!complete || reader.remaining() != 0) {
+                // More data follows the root, only used when no walk is cut off by the end of the prefix
+                if (!complete && !trailing) { trailing = format; }
+                continue;
+            }
+        } catch (NbtTruncatedError const&) {
+            if (complete) { continue; }
+        } catch (NbtFormatError const&) { continue; }
+        if (complete) {
+            ambiguous = false;
+            return format;
+        }
+        if (!result) { result = format; }
+        ++candidates;
+    }
+    ambiguous = candidates > 1;
+    if (ambiguous) { return std::nullopt; }
+    return result ? result : trailing;
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,268 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "NbtSchema.hpp"
+
+namespace rapidnbt {
+
+namespace {
+
+using Node = NbtSchema::Node;
+
+Node compileNode(py::handle spec, std::string_view key);
+
+Node compileCompound(py::handle spec) {
+    Node node;
+    for (auto [name, field] : py::reinterpret_borrow<py::dict>(spec)) {
+        auto key   = to_cpp_key(name);
+        auto child = compileNode(field, key);
+        node.mFields.insert_or_assign(std::move(key), std::move(child));
+    }
+    return node;
+}
+
+// "Short", "IntArray", "List[Double]", "List[List[String]]", ...
+Node parseType(std::string_view text, std::string_view key) {
+    while (!text.empty() && text.front() == ' ') { text.remove_prefix(1); }
+    while (!text.empty() && text.back() == ' ') { text.remove_suffix(1); }
+    Node node;
+    if (text.starts_with("List[") && text.ends_with("]")) {
+        node.mType = nbt::Tag::Type::List;
+        node.mElement.push_back(parseType(text.substr(5, text.size() - 6), key));
+        return node;
+    }
+    auto type = magic_enum::enum_cast<nbt::Tag::Type>(text);
+    if (!type || *type == nbt::Tag::Type::End) {
+        throw py::value_error(std::format("Invalid schema type \"{}\" for key \"{}\"", text, key));
+    }
+    node.mType = *type;
+    return node;
+}
+
+Node compileNode(py::handle spec, std::string_view key) {
+    if (PyDict_Check(spec.ptr())) { return compileCompound(spec); }
+    if (PyList_Check(spec.ptr()) || PyTuple_Check(spec.ptr())) {
+        auto elements = py::reinterpret_borrow<py::sequence>(spec);
+        if (elements.size() > 1) {
+            throw py::value_error(std::format("List schema for key \"{}\" must have at most one element type, received {}", key, elements.size()));
+        }
+        Node node{nbt::Tag::Type::List};
+        if (elements.size() == 1) { node.mElement.push_back(compileNode(elements[0], key)); }
+        return node;
+    }
+    if (PyUnicode_Check(spec.ptr())) { return parseType(to_cpp_key(spec), key); }
+    nbt::Tag::Type type;
+    try {
+        type = spec.cast<nbt::Tag::Type>();
+    } catch (py::cast_error const&) {
+        throw py::type_error(
+            std::format(
+                "Invalid schema for key \"{}\": expected TagType, str, dict or list, received {}",
+                key,
+                py_type_name(py::reinterpret_borrow<py::object>(spec))
+            )
+        );
+    }
+    if (type == nbt::Tag::Type::End) { throw py::value_error(std::format("Invalid schema type End for key \"{}\"", key)); }
+    return Node{type};
+}
+
+void describe(Node const& node, std::string& output) {
+    if (node.mType == nbt::Tag::Type::Compound) {
+        output += '{';
+        for (auto const& [key, field] : node.mFields) {
+            if (output.back() != '{') { output += ", "; }
+            output += key;
+            output += ": ";
+            describe(field, output);
+        }
+        output += '}';
+    } else if (node.mType == nbt::Tag::Type::List && !node.mElement.empty()) {
+        output += "List[";
+        describe(node.mElement.front(), output);
+        output += ']';
+    } else {
+        output += ENUM(node.mType);
+    }
+}
+
+[[noreturn]] void throwTypeMismatch(py::handle obj, Node const& node, std::string_view key) {
+    throw py::type_error(
+        std::format(
+            "Schema expects {} for key \"{}\", received {}",
+            ENUM(node.mType),
+            key,
+            py_type_name(py::reinterpret_borrow<py::object>(obj))
+        )
+    );
+}
+
+// Values that are already tags are kept as they are, whatever the schema says
+std::unique_ptr<nbt::Tag> makeUntypedTag(py::handle obj, Node const& node, std::string_view key) {
+    auto value = py::reinterpret_borrow<py::object>(obj);
+    if (py::isinstance<nbt::Tag>(value) || py::isinstance<nbt::CompoundTagVariant>(value)) { return makeNativeTag(value); }
+    throwTypeMismatch(obj, node, key);
+}
+
+// obj must be an int, range checked as in to_cpp_int
+template <std::integral T>
+T makeInteger(py::handle obj, nbt::Tag::Type type) {
+    using UT      = std::make_unsigned_t<T>;
+    using ST      = std::make_signed_t<T>;
+    int  overflow = 0;
+    auto value    = PyLong_AsLongLongAndOverflow(obj.ptr(), &overflow);
+    if (value == -1 && PyErr_Occurred()) { throw py::error_already_set(); }
+    if (overflow == 0 && value >= std::numeric_limits<ST>::min()) {
+        if constexpr (sizeof(T) < sizeof(long long)) {
+            if (value <= static_cast<long long>(std::numeric_limits<UT>::max())) { return static_cast<T>(static_cast<UT>(value)); }
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+    return to_cpp_int<T>(py::reinterpret_borrow<py::int_>(obj), ENUM(type));
+}
+
+template <std::integral T>
+void assignIntegers(std::vector<T>& storage, py::handle obj, Node const& node, std::string_view key) {
+    auto sequence = py::reinterpret_steal<py::object>(PySequence_Fast(obj.ptr(), "expected a sequence"));
+    if (!sequence) { throw py::error_already_set(); }
+    auto size  = PySequence_Fast_GET_SIZE(sequence.ptr());
+    auto items = PySequence_Fast_ITEMS(sequence.ptr());
+    storage.clear();
+    storage.reserve(static_cast<std::size_t>(size));
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        if (!PyLong_Check(items[i])) { throwTypeMismatch(items[i], node, key); }
+        storage.push_back(makeInteger<T>(items[i], node.mType));
+    }
+}
+
+template <typename Tag>
+std::unique_ptr<nbt::Tag> makeArrayTag(py::handle obj, Node const& node, std::string_view key) {
+    auto tag = std::make_unique<Tag>();
+    if (PyList_Check(obj.ptr()) || PyTuple_Check(obj.ptr())) {
+        assignIntegers(tag->storage(), obj, node, key);
+    } else if (PyObject_CheckBuffer(obj.ptr())) {
+        assign_from_buffer(tag->storage(), py::reinterpret_borrow<py::buffer>(obj));
+    } else {
+        return makeUntypedTag(obj, node, key);
+    }
+    return tag;
+}
+
+std::unique_ptr<nbt::CompoundTag> makeCompound(py::handle obj, Node const& node);
+
+std::unique_ptr<nbt::Tag> makeTypedTag(py::handle obj, Node const& node, std::string_view key) {
+    auto ptr = obj.ptr();
+    switch (node.mType) {
+    case nbt::Tag::Type::Byte:
+        if (!PyLong_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        return std::make_unique<nbt::ByteTag>(makeInteger<uint8_t>(obj, node.mType));
+    case nbt::Tag::Type::Short:
+        if (!PyLong_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        return std::make_unique<nbt::ShortTag>(makeInteger<short>(obj, node.mType));
+    case nbt::Tag::Type::Int:
+        if (!PyLong_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        return std::make_unique<nbt::IntTag>(makeInteger<int>(obj, node.mType));
+    case nbt::Tag::Type::Long:
+        if (!PyLong_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        return std::make_unique<nbt::LongTag>(makeInteger<int64_t>(obj, node.mType));
+    case nbt::Tag::Type::Float:
+    case nbt::Tag::Type::Double: {
+        if (!PyFloat_Check(ptr) && !PyLong_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        auto value = PyFloat_AsDouble(ptr);
+        if (value == -1.0 && PyErr_Occurred()) { throw py::error_already_set(); }
+        if (node.mType == nbt::Tag::Type::Float) { return std::make_unique<nbt::FloatTag>(static_cast<float>(value)); }
+        return std::make_unique<nbt::DoubleTag>(value);
+    }
+    case nbt::Tag::Type::String:
+        if (!PyUnicode_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        return std::make_unique<nbt::StringTag>(to_cpp_key(obj));
+    case nbt::Tag::Type::ByteArray:
+        if (PyBytes_Check(ptr) || PyByteArray_Check(ptr)) {
+            return std::make_unique<nbt::ByteArrayTag>(to_cpp_stringview(py::reinterpret_borrow<py::buffer>(obj)));
+        }
+        return makeArrayTag<nbt::ByteArrayTag>(obj, node, key);
+    case nbt::Tag::Type::IntArray:
+        return makeArrayTag<nbt::IntArrayTag>(obj, node, key);
+    case nbt::Tag::Type::LongArray:
+        return makeArrayTag<nbt::LongArrayTag>(obj, node, key);
+    case nbt::Tag::Type::List: {
+        if (!PyList_Check(ptr) && !PyTuple_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        auto size  = PySequence_Fast_GET_SIZE(ptr);
+        auto items = PySequence_Fast_ITEMS(ptr);
+        auto tag   = std::make_unique<nbt::ListTag>();
+        tag->reserve(static_cast<std::size_t>(size));
+        if (node.mElement.empty()) {
+            for (Py_ssize_t i = 0; i < size; ++i) { tag->push_back(makeNativeTag(py::reinterpret_borrow<py::object>(items[i]))); }
+            tag->checkAndFixElements();
+        } else {
+            for (Py_ssize_t i = 0; i < size; ++i) { tag->push_back(makeTypedTag(items[i], node.mElement.front(), key)); }
+        }
+        return tag;
+    }
+    case nbt::Tag::Type::Compound:
+        if (!PyDict_Check(ptr)) { return makeUntypedTag(obj, node, key); }
+        return makeCompound(obj, node);
+    default:
+        return makeNativeTag(py::reinterpret_borrow<py::object>(obj));
+    }
+}
+
+std::unique_ptr<nbt::CompoundTag> makeCompound(py::handle obj, Node const& node) {
+    auto       tag   = std::make_unique<nbt::CompoundTag>();
+    PyObject*  key   = nullptr;
+    PyObject*  value = nullptr;
+    Py_ssize_t pos   = 0;
+    while (PyDict_Next(obj.ptr(), &pos, &key, &value)) {
+        auto name  = to_cpp_key(key);
+        auto field = node.mFields.find(name);
+        if (field != node.mFields.end()) {
+            tag->set(name, makeTypedTag(value, field->second, name));
+        } else {
+            tag->set(name, makeNativeTag(py::reinterpret_borrow<py::object>(value)));
+        }
+    }
+    return tag;
+}
+
+} // namespace
+
+NbtSchema NbtSchema::compile(py::dict const& spec) {
+    NbtSchema schema;
+    schema.mRoot = compileCompound(spec);
+    return schema;
+}
+
+std::string NbtSchema::text() const {
+    std::string result;
+    describe(mRoot, result);
+    return result;
+}
+
+std::unique_ptr<nbt::CompoundTag> makeNativeCompound(py::dict const& obj, NbtSchema const& schema) { return makeCompound(obj, schema.root()); }
+
+void bindNbtSchema(py::module& m) {
+    auto sm = m.def_submodule("nbt_schema", "Tag types for building typed tags from plain Python values");
+
+    py::class_<NbtSchema>(sm, "NbtSchema")
+        .def(
+            py::init(&NbtSchema::compile),
+            py::arg("schema"),
+            "Compile a schema mapping keys to tag types\nA type is a TagType, its name as str, a dict for a nested compound or a list with one "
+            "element type (an empty list or TagType.List leaves the elements inferred)\nExample:\n    NbtSchema({\"Pos\": \"List[Double]\", "
+            "\"Health\": TagType.Short, \"UUID\": TagType.IntArray, \"Attributes\": [{\"Base\": TagType.Double}]})\nThrow TypeError or "
+            "ValueError if the schema is malformed"
+        )
+        .def("__str__", &NbtSchema::text, "The schema in string form, e.g. {Health: Short, Pos: List[Double]}")
+        .def(
+            "__repr__",
+            [](NbtSchema const& self) { return std::format("<rapidnbt.NbtSchema({0}) object at 0x{1:0{2}X}>", self.text(), ADDRESS); },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,39 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "NativeModule.hpp"
+#include <map>
+
+namespace rapidnbt {
+
+// Tag types for the keys of a compound, e.g. {"Pos": "List[Double]", "Health": TagType.Short, "UUID": TagType.IntArray}
+// Plain Python values under a typed key are converted straight to that type, keys the schema does not mention are inferred
+// as in CompoundTag(dict)
+class NbtSchema {
+public:
+    struct Node {
+        nbt::Tag::Type                           mType{nbt::Tag::Type::Compound};
+        std::map<std::string, Node, std::less<>> mFields{};  // Compound: typed keys
+        std::vector<Node>                        mElement{}; // List: element schema, empty when elements are inferred
+    };
+
+    // Throw TypeError or ValueError if the specification is malformed
+    static NbtSchema compile(py::dict const& spec);
+
+    Node const& root() const noexcept { return mRoot; }
+
+    // Specification in the string form, e.g. {Health: Short, Pos: List[Double]}
+    std::string text() const;
+
+private:
+    Node mRoot;
+};
+
+std::unique_ptr<nbt::CompoundTag> makeNativeCompound(py::dict const& obj, NbtSchema const& schema);
+
+} // namespace rapidnbt
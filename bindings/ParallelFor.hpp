@@ -0,0 +1,41 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace rapidnbt {
+
+inline std::size_t resolveThreadCount(std::size_t threads, std::size_t count) noexcept {
+    if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+    return std::max<std::size_t>(1, std::min(threads, count));
+}
+
+// Run body(index) for every index in [0, count) on up to `threads` workers (0 = one per hardware thread)
+// Workers claim the next index from a shared counter, so slow items never hold up the rest of the batch
+// body must not throw
+template <typename Body>
+void parallelFor(std::size_t count, std::size_t threads, Body&& body) {
+    threads = resolveThreadCount(threads, count);
+    if (threads == 1) {
+        for (std::size_t i = 0; i < count; ++i) { body(i); }
+        return;
+    }
+    std::atomic<std::size_t> next{0};
+    auto                     worker = [&] {
+        for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed)) { body(i); }
+    };
+    std::vector<std::jthread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i) { workers.emplace_back(worker); }
+    worker();
+}
+
+} // namespace rapidnbt
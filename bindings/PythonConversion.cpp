@@ -0,0 +1,183 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "PythonConversion.hpp"
+#include <pybind11/gil_safe_call_once.h>
+#include <unordered_map>
+
+namespace rapidnbt {
+
+namespace {
+
+py::object steal(PyObject* object) {
+    if (!object) { throw py::error_already_set(); }
+    return py::reinterpret_steal<py::object>(object);
+}
+
+py::object makeDict(std::size_t size) {
+#ifdef Py_LIMITED_API
+    (void)size;
+    return steal(PyDict_New());
+#else
+    return steal(_PyDict_NewPresized(static_cast<Py_ssize_t>(size)));
+#endif
+}
+
+template <typename T>
+py::object makeNumber(T value, py::object const& ctype, bool typed) {
+    py::object result;
+    if constexpr (std::is_floating_point_v<T>) {
+        result = steal(PyFloat_FromDouble(static_cast<double>(value)));
+    } else if constexpr (std::is_signed_v<T>) {
+        result = steal(PyLong_FromLongLong(static_cast<long long>(value)));
+    } else {
+        result = steal(PyLong_FromUnsignedLongLong(static_cast<unsigned long long>(value)));
+    }
+    return typed ? ctype(result) : result;
+}
+
+template <typename T>
+py::object makeArray(std::vector<T> const& storage, char typecode, ArrayFormat format) {
+    if (format == ArrayFormat::List) {
+        auto list = steal(PyList_New(static_cast<Py_ssize_t>(storage.size())));
+        for (std::size_t i = 0; i < storage.size(); ++i) {
+            PyList_SET_ITEM(list.ptr(), static_cast<Py_ssize_t>(i), makeNumber(storage[i], {}, false).release().ptr());
+        }
+        return list;
+    }
+    auto bytes = py::bytes(reinterpret_cast<const char*>(storage.data()), storage.size() * sizeof(T));
+    if (format == ArrayFormat::Bytes && sizeof(T) == 1) { return std::move(bytes); }
+    return pythonTypes().mArray(py::str(&typecode, 1), bytes);
+}
+
+// One str per distinct compound key for the duration of a conversion. Chunk, entity and palette data repeat the same few keys
+// (id, Pos, Name, States, Count) for every element, sharing them saves a decode and an allocation per entry and lets dict
+// insertion reuse the hash cached in the str. The views point into the tags being converted, which cannot change while the GIL
+// is held
+class KeyPool {
+public:
+    explicit KeyPool(bool intern) : mIntern(intern) {}
+
+    py::object const& get(std::string_view key) {
+        auto [iter, inserted] = mKeys.try_emplace(key);
+        if (inserted) {
+            auto text = to_py_text(key);
+            if (mIntern && PyUnicode_CheckExact(text.ptr())) {
+                auto* object = text.release().ptr();
+                PyUnicode_InternInPlace(&object);
+                text = steal(object);
+            }
+            iter->second = std::move(text);
+        }
+        return iter->second;
+    }
+
+private:
+    bool                                             mIntern;
+    std::unordered_map<std::string_view, py::object> mKeys;
+};
+
+class PythonConverter {
+public:
+    explicit PythonConverter(PythonConversionOptions const& options)
+    : mOptions(options),
+      mTypes(pythonTypes()),
+      mKeys(options.mInternKeys) {}
+
+    py::object convert(nbt::CompoundTag const& tag) {
+        auto dict = makeDict(tag.size());
+        for (auto const& [key, value] : tag) {
+            auto item = convert(value);
+            if (PyDict_SetItem(dict.ptr(), mKeys.get(key).ptr(), item.ptr()) != 0) { throw py::error_already_set(); }
+        }
+        return dict;
+    }
+
+    py::object convert(nbt::ListTag const& tag) {
+        auto       list  = steal(PyList_New(static_cast<Py_ssize_t>(tag.size())));
+        Py_ssize_t index = 0;
+        for (auto const& element : tag) { PyList_SET_ITEM(list.ptr(), index++, convert(element).release().ptr()); }
+        return list;
+    }
+
+    py::object convert(nbt::CompoundTagVariant const& tag) {
+        auto const& types = mTypes;
+        auto        typed = mOptions.mTypedNumbers;
+        return std::visit(
+            [&](auto const& value) -> py::object {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, nbt::CompoundTag> || std::is_same_v<T, nbt::ListTag>) {
+                    return convert(value);
+                } else if constexpr (std::is_same_v<T, nbt::ByteTag>) {
+                    return makeNumber(value.storage(), types.mUInt8, typed);
+                } else if constexpr (std::is_same_v<T, nbt::ShortTag>) {
+                    return makeNumber(value.storage(), types.mInt16, typed);
+                } else if constexpr (std::is_same_v<T, nbt::IntTag>) {
+                    return makeNumber(value.storage(), types.mInt32, typed);
+                } else if constexpr (std::is_same_v<T, nbt::LongTag>) {
+                    return makeNumber(value.storage(), types.mInt64, typed);
+                } else if constexpr (std::is_same_v<T, nbt::FloatTag>) {
+                    return makeNumber(value.storage(), types.mFloat, typed);
+                } else if constexpr (std::is_same_v<T, nbt::DoubleTag>) {
+                    return makeNumber(value.storage(), types.mDouble, typed);
+                } else if constexpr (std::is_same_v<T, nbt::StringTag>) {
+                    return to_py_text(value.storage());
+                } else if constexpr (std::is_same_v<T, nbt::ByteArrayTag>) {
+                    return makeArray(value.storage(), 'B', mOptions.mArrays);
+                } else if constexpr (std::is_same_v<T, nbt::IntArrayTag>) {
+                    return makeArray(value.storage(), 'i', mOptions.mArrays);
+                } else if constexpr (std::is_same_v<T, nbt::LongArrayTag>) {
+                    return makeArray(value.storage(), 'q', mOptions.mArrays);
+                } else {
+                    return py::none();
+                }
+            },
+            tag.mStorage
+        );
+    }
+
+private:
+    PythonConversionOptions const& mOptions;
+    PythonTypes const&             mTypes;
+    KeyPool                        mKeys;
+};
+
+} // namespace
+
+PythonTypes const& pythonTypes() {
+    PYBIND11_CONSTINIT static py::gil_safe_call_once_and_store<PythonTypes> storage;
+    return storage
+        .call_once_and_store_result([] {
+            auto ctypes = py::module::import("ctypes");
+            return PythonTypes{
+                py::module::import("array").attr("array"),
+                ctypes.attr("c_int8"),
+                ctypes.attr("c_uint8"),
+                ctypes.attr("c_int16"),
+                ctypes.attr("c_uint16"),
+                ctypes.attr("c_int32"),
+                ctypes.attr("c_uint32"),
+                ctypes.attr("c_int64"),
+                ctypes.attr("c_uint64"),
+                ctypes.attr("c_float"),
+                ctypes.attr("c_double"),
+            };
+        })
+        .get_stored();
+}
+
+py::object makePythonObject(nbt::CompoundTag const& tag, PythonConversionOptions const& options) {
+    return PythonConverter(options).convert(tag);
+}
+
+py::object makePythonObject(nbt::ListTag const& tag, PythonConversionOptions const& options) { return PythonConverter(options).convert(tag); }
+
+py::object makePythonObject(nbt::CompoundTagVariant const& tag, PythonConversionOptions const& options) {
+    return PythonConverter(options).convert(tag);
+}
+
+} // namespace rapidnbt
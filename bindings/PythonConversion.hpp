@@ -0,0 +1,52 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "NativeModule.hpp"
+
+namespace rapidnbt {
+
+// How byte, int and long arrays are returned by to_python()
+enum class ArrayFormat {
+    List,  // list of int
+    Bytes, // bytes for byte arrays, array.array for int and long arrays
+    Array, // array.array ('B', 'i' or 'q')
+};
+
+struct PythonConversionOptions {
+    ArrayFormat mArrays{ArrayFormat::Bytes};
+    // Return numbers as ctypes instances (c_uint8, c_int16, c_int32, c_int64, c_float, c_double) so the tag types survive a
+    // round trip through CompoundTag(dict)
+    bool mTypedNumbers{false};
+    // Intern compound keys in the interpreter-wide string table (sys.intern) so they are shared across documents and with
+    // string literals, keys repeated within one conversion always share a single str
+    bool mInternKeys{false};
+};
+
+// Python types looked up once per interpreter instead of on every conversion
+struct PythonTypes {
+    py::object mArray;
+    py::object mInt8;
+    py::object mUInt8;
+    py::object mInt16;
+    py::object mUInt16;
+    py::object mInt32;
+    py::object mUInt32;
+    py::object mInt64;
+    py::object mUInt64;
+    py::object mFloat;
+    py::object mDouble;
+};
+
+PythonTypes const& pythonTypes();
+
+// Build plain dict / list / int / float / str / bytes objects in one native pass
+py::object makePythonObject(nbt::CompoundTag const& tag, PythonConversionOptions const& options);
+py::object makePythonObject(nbt::ListTag const& tag, PythonConversionOptions const& options);
+py::object makePythonObject(nbt::CompoundTagVariant const& tag, PythonConversionOptions const& options);
+
+} // namespace rapidnbt
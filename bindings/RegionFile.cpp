@@ -0,0 +1,419 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "RegionFile.hpp"
+#include "Compression.hpp"
+#include "NativeModule.hpp"
+#include "ParallelFor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <exception>
+#include <fstream>
+
+namespace rapidnbt {
+
+namespace {
+
+constexpr std::size_t MAX_SECTOR_COUNT  = 0xFF;
+constexpr std::size_t MAX_SECTOR_OFFSET = 0xFFFFFF;
+
+uint32_t readBigEndian(const char* data) noexcept {
+    auto bytes = reinterpret_cast<const uint8_t*>(data);
+    return static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16 | static_cast<uint32_t>(bytes[2]) << 8 | bytes[3];
+}
+
+void writeBigEndian(char* data, uint32_t value) noexcept {
+    for (int i = 0; i < 4; ++i) { data[i] = static_cast<char>(value >> (24 - i * 8) & 0xFF); }
+}
+
+uint32_t currentTimestamp() noexcept {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+// Region coordinates from a "r.<x>.<z>.mca" file name, needed to name the external chunk files
+std::optional<std::pair<int, int>> regionCoordsOf(std::filesystem::path const& path) {
+    auto name = path.stem().string();
+    if (!name.starts_with("r.")) { return std::nullopt; }
+    auto separator = name.find('.', 2);
+    if (separator == std::string::npos) { return std::nullopt; }
+    int  x = 0, z = 0;
+    auto end = name.data() + name.size();
+    if (std::from_chars(name.data() + 2, name.data() + separator, x).ptr != name.data() + separator) { return std::nullopt; }
+    if (std::from_chars(name.data() + separator + 1, end, z).ptr != end) { return std::nullopt; }
+    return std::pair{x, z};
+}
+
+std::filesystem::path externalPathOf(std::filesystem::path const& region, std::pair<int, int> origin, std::size_t index) {
+    return region.parent_path() / std::format("c.{}.{}.mcc", origin.first * 32 + static_cast<int>(index & 31), origin.second * 32 + static_cast<int>(index >> 5));
+}
+
+bool writeFile(std::filesystem::path const& path, std::string_view content) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    file.close();
+    return !file.fail();
+}
+
+} // namespace
+
+std::unique_ptr<RegionFile> RegionFile::open(std::filesystem::path const& path, bool fileMemoryMap) {
+    auto buffer = ContentBuffer::fromFile(path, fileMemoryMap);
+    if (!buffer) { return nullptr; }
+    auto content = buffer->view();
+    // the game creates zero-length region files before the first chunk is saved
+    if (!content.empty() && content.size() < 2 * SECTOR_SIZE) { return nullptr; }
+
+    auto region   = std::make_unique<RegionFile>();
+    region->mPath = path;
+    if (content.empty()) { return region; }
+    auto origin = regionCoordsOf(path);
+    for (std::size_t index = 0; index < CHUNK_COUNT; ++index) {
+        auto location = readBigEndian(content.data() + index * 4);
+        auto offset   = static_cast<std::size_t>(location >> 8) * SECTOR_SIZE;
+        if (location == 0 || offset < 2 * SECTOR_SIZE || offset + 5 > content.size()) { continue; }
+        auto length = readBigEndian(content.data() + offset);
+        if (length == 0 || length - 1 > content.size() - offset - 5) { continue; }
+
+        Chunk chunk;
+        chunk.mCompression = static_cast<uint8_t>(content[offset + 4]);
+        chunk.mTimestamp   = readBigEndian(content.data() + SECTOR_SIZE + index * 4);
+        if (chunk.mCompression & static_cast<uint8_t>(ChunkCompression::External)) {
+            if (!origin) { continue; }
+            auto external = ContentBuffer::fromFile(externalPathOf(path, *origin, index), false);
+            if (!external) { continue; }
+            chunk.mStorage = external->view();
+            chunk.mOwned   = true;
+        } else {
+            chunk.mView = content.substr(offset + 5, length - 1);
+        }
+        region->mChunks[index] = std::move(chunk);
+    }
+    region->mBuffer = std::move(buffer);
+    return region;
+}
+
+std::size_t RegionFile::size() const {
+    std::shared_lock lock(mMutex);
+    return static_cast<std::size_t>(std::ranges::count_if(mChunks, [](auto const& chunk) { return chunk.has_value(); }));
+}
+
+bool RegionFile::contains(std::size_t index) const {
+    std::shared_lock lock(mMutex);
+    return mChunks[index].has_value();
+}
+
+std::optional<uint32_t> RegionFile::timestamp(std::size_t index) const {
+    std::shared_lock lock(mMutex);
+    if (!mChunks[index]) { return std::nullopt; }
+    return mChunks[index]->mTimestamp;
+}
+
+std::vector<std::size_t> RegionFile::indices() const {
+    std::shared_lock         lock(mMutex);
+    std::vector<std::size_t> result;
+    for (std::size_t index = 0; index < CHUNK_COUNT; ++index) {
+        if (mChunks[index]) { result.push_back(index); }
+    }
+    return result;
+}
+
+std::optional<nbt::CompoundTag> RegionFile::read(std::size_t index) const {
+    std::shared_lock lock(mMutex);
+    return readLocked(index);
+}
+
+std::optional<nbt::CompoundTag> RegionFile::readLocked(std::size_t index) const {
+    auto const& chunk = mChunks[index];
+    if (!chunk) { return std::nullopt; }
+    auto payload = chunk->payload();
+    switch (static_cast<ChunkCompression>(chunk->mCompression & ~static_cast<uint8_t>(ChunkCompression::External))) {
+    case ChunkCompression::Gzip:
+    case ChunkCompression::Zlib: {
+        auto inflated = decompress(payload);
+        if (!inflated) { return std::nullopt; }
+        return nbt::io::parseFromContent(inflated->view(), nbt::NbtFileFormat::BigEndian, false);
+    }
+    case ChunkCompression::None:
+        return nbt::io::parseFromContent(payload, nbt::NbtFileFormat::BigEndian, false);
+    default:
+        // LZ4 and custom compression schemes are not supported
+        return std::nullopt;
+    }
+}
+
+std::vector<std::optional<nbt::CompoundTag>> RegionFile::read(std::vector<std::size_t> const& indices, std::size_t threads) const {
+    std::shared_lock                             lock(mMutex);
+    std::vector<std::optional<nbt::CompoundTag>> results(indices.size());
+    parallelFor(indices.size(), threads, [&](std::size_t index) {
+        try {
+            results[index] = readLocked(indices[index]);
+        } catch (...) {}
+    });
+    return results;
+}
+
+RegionFile::Chunk RegionFile::encode(
+    nbt::CompoundTag const&  tag,
+    nbt::NbtCompressionType  compressionType,
+    nbt::NbtCompressionLevel compressionLevel,
+    uint32_t                 timestamp
+) {
+    Chunk chunk;
+    switch (compressionType) {
+    case nbt::NbtCompressionType::Gzip:
+        chunk.mCompression = static_cast<uint8_t>(ChunkCompression::Gzip);
+        break;
+    case nbt::NbtCompressionType::Zlib:
+        chunk.mCompression = static_cast<uint8_t>(ChunkCompression::Zlib);
+        break;
+    default:
+        chunk.mCompression = static_cast<uint8_t>(ChunkCompression::None);
+    }
+    chunk.mTimestamp = timestamp;
+    chunk.mStorage   = nbt::io::saveAsBinary(tag, nbt::NbtFileFormat::BigEndian, compressionType, compressionLevel, std::nullopt);
+    chunk.mOwned     = true;
+    return chunk;
+}
+
+void RegionFile::write(
+    std::size_t              index,
+    nbt::CompoundTag const&  tag,
+    nbt::NbtCompressionType  compressionType,
+    nbt::NbtCompressionLevel compressionLevel,
+    std::optional<uint32_t>  timestamp
+) {
+    auto             chunk = encode(tag, compressionType, compressionLevel, timestamp.value_or(currentTimestamp()));
+    std::unique_lock lock(mMutex);
+    mChunks[index] = std::move(chunk);
+}
+
+void RegionFile::write(
+    std::vector<std::pair<std::size_t, nbt::CompoundTag const*>> const& chunks,
+    nbt::NbtCompressionType                                             compressionType,
+    nbt::NbtCompressionLevel                                            compressionLevel,
+    std::optional<uint32_t>                                             timestamp,
+    std::size_t                                                         threads
+) {
+    auto               time = timestamp.value_or(currentTimestamp());
+    std::vector<Chunk> encoded(chunks.size());
+    std::exception_ptr error;
+    std::atomic_flag   failed;
+    parallelFor(chunks.size(), threads, [&](std::size_t index) {
+        try {
+            encoded[index] = encode(*chunks[index].second, compressionType, compressionLevel, time);
+        } catch (...) {
+            if (!failed.test_and_set()) { error = std::current_exception(); }
+        }
+    });
+    if (error) { std::rethrow_exception(error); }
+    std::unique_lock lock(mMutex);
+    for (std::size_t i = 0; i < chunks.size(); ++i) { mChunks[chunks[i].first] = std::move(encoded[i]); }
+}
+
+bool RegionFile::remove(std::size_t index) {
+    std::unique_lock lock(mMutex);
+    if (!mChunks[index]) { return false; }
+    mChunks[index].reset();
+    return true;
+}
+
+bool RegionFile::save(std::filesystem::path const& path) {
+    std::unique_lock lock(mMutex);
+    std::error_code  error;
+    if (mBuffer && std::filesystem::equivalent(path, mPath, error)) {
+        // the views point into the file which is about to be overwritten
+        for (auto& chunk : mChunks) {
+            if (chunk && !chunk->mOwned) {
+                chunk->mStorage = chunk->mView;
+                chunk->mOwned   = true;
+            }
+        }
+        mBuffer.reset();
+    }
+
+    auto                                                             origin = regionCoordsOf(path);
+    std::vector<std::pair<std::filesystem::path, std::string_view>> externals;
+    std::string                                                      content(2 * SECTOR_SIZE, '\0');
+    for (std::size_t index = 0; index < CHUNK_COUNT; ++index) {
+        auto const& chunk = mChunks[index];
+        if (!chunk) { continue; }
+        auto payload     = chunk->payload();
+        auto compression = static_cast<uint8_t>(chunk->mCompression & ~static_cast<uint8_t>(ChunkCompression::External));
+        auto offset      = content.size() / SECTOR_SIZE;
+        auto sectors     = (payload.size() + 5 + SECTOR_SIZE - 1) / SECTOR_SIZE;
+        if (sectors > MAX_SECTOR_COUNT) {
+            if (!origin) { return false; }
+            externals.emplace_back(externalPathOf(path, *origin, index), payload);
+            payload      = {};
+            compression |= static_cast<uint8_t>(ChunkCompression::External);
+            sectors      = 1;
+        }
+        if (offset > MAX_SECTOR_OFFSET) { return false; }
+        writeBigEndian(content.data() + index * 4, static_cast<uint32_t>(offset << 8 | sectors));
+        writeBigEndian(content.data() + SECTOR_SIZE + index * 4, chunk->mTimestamp);
+
+        content.resize((offset + sectors) * SECTOR_SIZE, '\0');
+        auto data = content.data() + offset * SECTOR_SIZE;
+        writeBigEndian(data, static_cast<uint32_t>(payload.size() + 1));
+        data[4] = static_cast<char>(compression);
+        if (!payload.empty()) { std::memcpy(data + 5, payload.data(), payload.size()); }
+    }
+    for (auto const& [externalPath, payload] : externals) {
+        if (!writeFile(externalPath, payload)) { return false; }
+    }
+    return writeFile(path, content);
+}
+
+void bindRegionFile(py::module& m) {
+    auto sm = m.def_submodule("region_file", "Anvil region file (.mca) of Java Edition worlds");
+
+    py::class_<RegionFile>(sm, "RegionFile")
+        .def(py::init<>(), "Construct an empty region")
+        .def_static(
+            "open",
+            &RegionFile::open,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("path"),
+            py::arg("file_memory_map") = false,
+            "Open a region file\nChunks are only decompressed and parsed when they are read\nArgs:\n    path (os.PathLike): Path to the .mca file\n    "
+            "file_memory_map (bool): Use memory mapping for large files (default: False)\nReturns:\n    RegionFile or None if the file cannot be read"
+        )
+        .def(
+            "has_chunk",
+            [](RegionFile const& self, int x, int z) { return self.contains(RegionFile::indexOf(x, z)); },
+            py::arg("x"),
+            py::arg("z"),
+            "Check if the chunk exists\nCoordinates are taken modulo 32, so region-local and world chunk coordinates are both accepted"
+        )
+        .def(
+            "chunk_coords",
+            [](RegionFile const& self) {
+                std::vector<std::pair<int, int>> result;
+                for (auto index : self.indices()) { result.emplace_back(static_cast<int>(index & 31), static_cast<int>(index >> 5)); }
+                return result;
+            },
+            "Get the region-local (x, z) coordinates of every stored chunk"
+        )
+        .def(
+            "get_timestamp",
+            [](RegionFile const& self, int x, int z) { return self.timestamp(RegionFile::indexOf(x, z)); },
+            py::arg("x"),
+            py::arg("z"),
+            "Get the last modification time of the chunk in epoch seconds\nReturns:\n    int or None if the chunk does not exist"
+        )
+        .def(
+            "read_chunk",
+            [](RegionFile const& self, int x, int z) { return self.read(RegionFile::indexOf(x, z)); },
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("x"),
+            py::arg("z"),
+            "Decompress and parse one chunk\nReturns:\n    CompoundTag or None if the chunk does not exist or cannot be parsed"
+        )
+        .def(
+            "read_chunks",
+            [](RegionFile const& self, std::optional<std::vector<std::pair<int, int>>> coords, std::size_t threads) {
+                if (!coords) {
+                    coords.emplace();
+                    for (auto index : self.indices()) { coords->emplace_back(static_cast<int>(index & 31), static_cast<int>(index >> 5)); }
+                }
+                std::vector<std::size_t> indices;
+                indices.reserve(coords->size());
+                for (auto [x, z] : *coords) { indices.push_back(RegionFile::indexOf(x, z)); }
+                std::vector<std::optional<nbt::CompoundTag>> chunks;
+                {
+                    py::gil_scoped_release release;
+                    chunks = self.read(indices, threads);
+                }
+                py::dict result;
+                for (std::size_t i = 0; i < chunks.size(); ++i) { result[py::make_tuple((*coords)[i].first, (*coords)[i].second)] = py::cast(std::move(chunks[i])); }
+                return result;
+            },
+            py::arg("coords")  = std::nullopt,
+            py::arg("threads") = 0,
+            "Decompress and parse chunks in parallel\nArgs:\n    coords (list[tuple[int, int]], optional): Chunks to read (default: None, every stored "
+            "chunk)\n    threads (int): Number of worker threads (default: 0, one per CPU)\nReturns:\n    dict of (x, z) to CompoundTag (None for chunks that "
+            "do not exist or cannot be parsed)"
+        )
+        .def(
+            "write_chunk",
+            [](RegionFile&              self,
+               int                      x,
+               int                      z,
+               nbt::CompoundTag const&  tag,
+               nbt::NbtCompressionType  compressionType,
+               nbt::NbtCompressionLevel compressionLevel,
+               std::optional<uint32_t>  timestamp) { self.write(RegionFile::indexOf(x, z), tag, compressionType, compressionLevel, timestamp); },
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("x"),
+            py::arg("z"),
+            py::arg("nbt"),
+            py::arg("compression_type")  = nbt::NbtCompressionType::Zlib,
+            py::arg("compression_level") = nbt::NbtCompressionLevel::Default,
+            py::arg("timestamp")         = std::nullopt,
+            "Serialize and store one chunk\nArgs:\n    x (int): Chunk x coordinate\n    z (int): Chunk z coordinate\n    nbt (CompoundTag): Chunk data\n    "
+            "compression_type (NbtCompressionType): Compression method (default: Zlib)\n    compression_level (NbtCompressionLevel): Compression level "
+            "(default: Default)\n    timestamp (int, optional): Modification time in epoch seconds (default: None, now)"
+        )
+        .def(
+            "write_chunks",
+            [](RegionFile&              self,
+               py::dict const&          chunks,
+               nbt::NbtCompressionType  compressionType,
+               nbt::NbtCompressionLevel compressionLevel,
+               std::optional<uint32_t>  timestamp,
+               std::size_t              threads) {
+                std::vector<std::pair<std::size_t, nbt::CompoundTag const*>> tags;
+                tags.reserve(chunks.size());
+                for (auto const& [coord, tag] : chunks) {
+                    auto [x, z] = coord.cast<std::pair<int, int>>();
+                    tags.emplace_back(RegionFile::indexOf(x, z), &tag.cast<nbt::CompoundTag const&>());
+                }
+                py::gil_scoped_release release;
+                self.write(tags, compressionType, compressionLevel, timestamp, threads);
+            },
+            py::arg("chunks"),
+            py::arg("compression_type")  = nbt::NbtCompressionType::Zlib,
+            py::arg("compression_level") = nbt::NbtCompressionLevel::Default,
+            py::arg("timestamp")         = std::nullopt,
+            py::arg("threads")           = 0,
+            "Serialize and compress chunks in parallel\nArgs:\n    chunks (dict[tuple[int, int], CompoundTag]): Chunk data by (x, z)\n    compression_type "
+            "(NbtCompressionType): Compression method (default: Zlib)\n    compression_level (NbtCompressionLevel): Compression level (default: Default)\n    "
+            "timestamp (int, optional): Modification time in epoch seconds (default: None, now)\n    threads (int): Number of worker threads (default: 0, one "
+            "per CPU)"
+        )
+        .def(
+            "remove_chunk",
+            [](RegionFile& self, int x, int z) { return self.remove(RegionFile::indexOf(x, z)); },
+            py::arg("x"),
+            py::arg("z"),
+            "Remove a chunk\nReturns:\n    True if the chunk existed"
+        )
+        .def(
+            "save",
+            &RegionFile::save,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("path"),
+            "Write the region to a file\nChunks are packed into 4 KiB sectors from sector 2 onwards, chunks larger than 255 sectors are written to "
+            "c.<x>.<z>.mcc files next to the region\nArgs:\n    path (os.PathLike): Output file path\nReturns:\n    True if successful"
+        )
+        .def("__len__", &RegionFile::size, "Get number of stored chunks")
+        .def(
+            "__contains__",
+            [](RegionFile const& self, std::pair<int, int> coord) { return self.contains(RegionFile::indexOf(coord.first, coord.second)); },
+            py::arg("coord"),
+            "Check if the chunk at (x, z) exists"
+        )
+        .def(
+            "__repr__",
+            [](RegionFile const& self) { return std::format("<rapidnbt.RegionFile(size={0}) object at 0x{1:0{2}X}>", self.size(), ADDRESS); },
+            "Official string representation"
+        );
+}
+
+} // namespace rapidnbt
@@ -0,0 +1,87 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "ContentBuffer.hpp"
+#include <array>
+#include <cstdint>
+#include <nbt/NBT.hpp>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+namespace rapidnbt {
+
+// Java Edition Anvil region (.mca): a 4 KiB location table, a 4 KiB timestamp table and up to 1024 big-endian chunks,
+// each stored as a 4-byte length, a compression byte and the payload, padded to whole 4 KiB sectors
+// Chunks are read under a shared lock and changed under an exclusive one, so the bindings may release the GIL for both
+class RegionFile {
+public:
+    static constexpr std::size_t SECTOR_SIZE = 4096;
+    static constexpr std::size_t CHUNK_COUNT = 1024;
+
+    // Compression byte of a chunk, chunks of 256 sectors or more are moved to a c.<x>.<z>.mcc file next to the region
+    enum class ChunkCompression : uint8_t { Gzip = 1, Zlib = 2, None = 3, External = 0x80 };
+
+    RegionFile() = default;
+
+    static std::unique_ptr<RegionFile> open(std::filesystem::path const& path, bool fileMemoryMap);
+
+    // Chunk coordinates are taken modulo 32, so both region-local and world chunk coordinates are accepted
+    static std::size_t indexOf(int x, int z) noexcept { return static_cast<std::size_t>(x & 31) | static_cast<std::size_t>(z & 31) << 5; }
+
+    std::size_t              size() const;
+    bool                     contains(std::size_t index) const;
+    std::optional<uint32_t>  timestamp(std::size_t index) const;
+    std::vector<std::size_t> indices() const;
+
+    std::optional<nbt::CompoundTag> read(std::size_t index) const;
+    // Inflate and parse the chunks on up to `threads` workers (0 = one per hardware thread), missing or broken chunks are nullopt
+    std::vector<std::optional<nbt::CompoundTag>> read(std::vector<std::size_t> const& indices, std::size_t threads) const;
+
+    void write(
+        std::size_t              index,
+        nbt::CompoundTag const&  tag,
+        nbt::NbtCompressionType  compressionType,
+        nbt::NbtCompressionLevel compressionLevel,
+        std::optional<uint32_t>  timestamp
+    );
+    // Serialize and compress the chunks in parallel, then store them in order
+    void write(
+        std::vector<std::pair<std::size_t, nbt::CompoundTag const*>> const& chunks,
+        nbt::NbtCompressionType                                             compressionType,
+        nbt::NbtCompressionLevel                                            compressionLevel,
+        std::optional<uint32_t>                                             timestamp,
+        std::size_t                                                         threads
+    );
+    bool remove(std::size_t index);
+
+    // Pack every chunk from sector 2 onwards and write the region (and any oversized chunk) to disk
+    bool save(std::filesystem::path const& path);
+
+private:
+    struct Chunk {
+        uint8_t          mCompression{};
+        uint32_t         mTimestamp{};
+        std::string_view mView{};
+        std::string      mStorage{};
+        bool             mOwned{false};
+
+        std::string_view payload() const noexcept { return mOwned ? std::string_view{mStorage} : mView; }
+    };
+
+    std::optional<nbt::CompoundTag> readLocked(std::size_t index) const;
+
+    static Chunk encode(nbt::CompoundTag const& tag, nbt::NbtCompressionType compressionType, nbt::NbtCompressionLevel compressionLevel, uint32_t timestamp);
+
+    std::shared_ptr<ContentBuffer>                 mBuffer{};
+    std::filesystem::path                          mPath{};
+    std::array<std::optional<Chunk>, CHUNK_COUNT> mChunks{};
+    mutable std::shared_mutex                      mMutex{};
+};
+
+} // namespace rapidnbt
@@ -0,0 +1,109 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "TagHash.hpp"
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+namespace rapidnbt {
+
+namespace {
+
+constexpr uint64_t SEED = 0x9E3779B97F4A7C15ull;
+
+constexpr uint64_t mix(uint64_t hash, uint64_t value) noexcept {
+    hash ^= value;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    return hash ^ (hash >> 31);
+}
+
+constexpr uint64_t finalize(uint64_t hash) noexcept {
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    return hash ^ (hash >> 33);
+}
+
+uint64_t hashBytes(uint64_t hash, void const* data, std::size_t size) noexcept {
+    auto bytes = static_cast<unsigned char const*>(data);
+    hash       = mix(hash, size);
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        hash = mix(hash, word);
+    }
+    if (size > 0) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes, size);
+        hash = mix(hash, word);
+    }
+    return hash;
+}
+
+template <typename T>
+uint64_t hashNumber(uint64_t hash, T value) noexcept {
+    if constexpr (std::is_same_v<T, float>) {
+        return mix(hash, std::bit_cast<uint32_t>(value));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return mix(hash, std::bit_cast<uint64_t>(value));
+    } else {
+        return mix(hash, static_cast<uint64_t>(value));
+    }
+}
+
+uint64_t hashTag(uint64_t hash, nbt::CompoundTagVariant const& tag);
+
+uint64_t hashTag(uint64_t hash, nbt::CompoundTag const& tag) {
+    hash = mix(hash, tag.size());
+    for (auto const& [key, value] : tag) {
+        hash = hashBytes(hash, key.data(), key.size());
+        hash = hashTag(hash, value);
+    }
+    return hash;
+}
+
+uint64_t hashTag(uint64_t hash, nbt::ListTag const& tag) {
+    hash = mix(hash, static_cast<uint64_t>(tag.getElementType()));
+    hash = mix(hash, tag.size());
+    for (auto const& element : tag) { hash = hashTag(hash, element); }
+    return hash;
+}
+
+uint64_t hashTag(uint64_t hash, nbt::CompoundTagVariant const& tag) {
+    hash = mix(hash, tag.mStorage.index());
+    return std::visit(
+        [hash](auto const& value) -> uint64_t {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, nbt::CompoundTag> || std::is_same_v<T, nbt::ListTag>) {
+                return hashTag(hash, value);
+            } else if constexpr (std::is_same_v<T, nbt::EndTag>) {
+                return hash;
+            } else {
+                auto const& storage = value.storage();
+                using S             = std::decay_t<decltype(storage)>;
+                if constexpr (std::is_arithmetic_v<S>) {
+                    return hashNumber(hash, storage);
+                } else {
+                    return hashBytes(hash, storage.data(), storage.size() * sizeof(*storage.data()));
+                }
+            }
+        },
+        tag.mStorage
+    );
+}
+
+} // namespace
+
+uint64_t contentHash(nbt::CompoundTagVariant const& tag) { return finalize(hashTag(SEED, tag)); }
+
+uint64_t contentHash(nbt::CompoundTag const& tag) { return finalize(hashTag(SEED, tag)); }
+
+uint64_t contentHash(nbt::ListTag const& tag) { return finalize(hashTag(SEED, tag)); }
+
+} // namespace rapidnbt
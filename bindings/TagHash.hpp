@@ -0,0 +1,20 @@
+// Copyright © 2025 GlacieTeam.All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <cstdint>
+#include <nbt/NBT.hpp>
+
+namespace rapidnbt {
+
+// 64-bit hash over every type, key and value byte of a tag tree, for telling whether a tree has changed
+// Trees that compare equal with their keys in the same order hash equal, the value is only stable within one process
+uint64_t contentHash(nbt::CompoundTagVariant const& tag);
+uint64_t contentHash(nbt::CompoundTag const& tag);
+uint64_t contentHash(nbt::ListTag const& tag);
+
+} // namespace rapidnbt
@@ -0,0 +1,18 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+
+from enum import Enum
+
+class ArrayFormat(Enum):
+    """
+    How to_python() returns byte, int and long arrays
+    """
+
+    LIST = 0
+    BYTES = 1
+    ARRAY = 2
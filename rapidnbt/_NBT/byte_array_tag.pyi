@@ -15,6 +15,12 @@ class ByteArrayTag(Tag):
     A tag contains a byte array
     """
 
+    def __buffer__(self, flags: int) -> memoryview:
+        """
+        Expose the bytes as a writable buffer, e.g. numpy.asarray(tag)
+        The array can not be resized (BufferError) while a view is alive, and views must not outlive the tag
+        """
+
     def __bytes__(self) -> bytes:
         """
         Convert to Python bytes object
@@ -101,6 +107,7 @@ class ByteArrayTag(Tag):
     def data(self) -> memoryview:
         """
         Get a raw memory view of the byte data
+        The array can not be resized while the view is alive
         """
 
     def equals(self, other: Tag) -> bool:
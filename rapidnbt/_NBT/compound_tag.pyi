@@ -6,10 +6,15 @@
 # SPDX-License-Identifier: MPL-2.0
 
 from collections.abc import Buffer
-from typing import overload, List, Dict, Optional, Any
+from typing import overload, List, Dict, Optional, Any, Union
 from .tag import Tag
+from .array_format import ArrayFormat
 from .tag_type import TagType
 from .compound_tag_variant import CompoundTagVariant
+from .frozen_compound_tag import FrozenCompoundTag
+from .nbt_path import NbtPath
+from .nbt_patch import NbtPatch
+from .nbt_schema import NbtSchema
 
 class CompoundTag(Tag):
     """
@@ -42,6 +47,25 @@ class CompoundTag(Tag):
         Deserialize from Network NBT format
         """
 
+    @staticmethod
+    def from_python(obj: Dict[str, Any], schema: Optional[NbtSchema] = None) -> CompoundTag:
+        """
+        Build a CompoundTag from plain Python objects
+        bool, int, float, str, bytes, dict, list and tuple map to ByteTag, IntTag, FloatTag, StringTag, ByteArrayTag,
+        CompoundTag and ListTag, ctypes numbers keep their width and array.array of 8, 32 or 64 bit integers becomes a
+        ByteArrayTag, IntArrayTag or LongArrayTag
+        Only the output of to_python(typed_numbers=True) round-trips exactly, plain numbers turn ByteTag, ShortTag and
+        LongTag into IntTag (LongTag values outside its range raise) and DoubleTag into FloatTag
+
+        Args:
+            obj (dict): Dict[str, Any] to convert
+            schema (NbtSchema, optional): Tag types for plain values under the keys it names, so no ctypes wrappers
+                are needed (default: None)
+
+        Returns:
+            CompoundTag
+        """
+
     @staticmethod
     def from_snbt(
         snbt: str, parsed_length: Optional[int] = None
@@ -117,6 +141,16 @@ class CompoundTag(Tag):
         String representation (SNBT minimized format)
         """
 
+    def apply_patch(self, patch: NbtPatch) -> None:
+        """
+        Apply a patch from diff() in place
+        Throw NbtPatchError (a ValueError) if this compound does not have the shape the patch expects, the edits before
+        the failing one stay applied
+
+        Args:
+            patch (NbtPatch): Patch to apply
+        """
+
     def clear(self) -> None:
         """
         Remove all elements from the compound
@@ -137,6 +171,8 @@ class CompoundTag(Tag):
     def copy(self) -> Tag:
         """
         Create a deep copy of this tag
+        The whole tree is copied, O(n) in the number of tags, move=True on set() or append() and take()
+        transfer a tag without copying
         """
 
     def deserialize(self, stream: ...) -> None:
@@ -144,6 +180,19 @@ class CompoundTag(Tag):
         Deserialize compound from a binary stream
         """
 
+    def diff(self, other: CompoundTag) -> NbtPatch:
+        """
+        Compute the edits turning this compound into another one
+        Unchanged subtrees produce no edits, changed list and array ranges become splices
+        Both trees are walked in full, unchanged subtrees are compared tag by tag rather than by hash, so the cost is O(n) in their size
+
+        Args:
+            other (CompoundTag): Target compound
+
+        Returns:
+            NbtPatch
+        """
+
     def empty(self) -> bool:
         """
         Check if the compound is empty
@@ -154,6 +203,16 @@ class CompoundTag(Tag):
         Check if this tag equals another tag
         """
 
+    def freeze(self) -> FrozenCompoundTag:
+        """
+        Build an immutable compact copy for read-mostly data
+        The copy uses contiguous storage with inline numbers and hashed key lookup, stores each distinct key once,
+        and can be read from many threads
+
+        Returns:
+            FrozenCompoundTag
+        """
+
     def get(self, key: str) -> CompoundTagVariant:
         """
         Get tag by key
@@ -168,6 +227,7 @@ class CompoundTag(Tag):
     def hash(self) -> int:
         """
         Compute hash value of this tag
+        The whole tree is hashed on every call, O(n) in the number of tags
         """
 
     def items(self) -> list:
@@ -199,14 +259,45 @@ class CompoundTag(Tag):
         Remove key from the compound
         """
 
+    def query(
+        self, path: Union[str, NbtPath]
+    ) -> Union[CompoundTagVariant, CompoundTag, int, None]:
+        """
+        Get the first tag matched by a path in /data command syntax
+
+        Example:
+            nbt.query("Level.Sections[3].BlockStates")
+            nbt.query("Items[{Slot:3b}].id")
+
+        Returns:
+            CompoundTagVariant, CompoundTag (empty path), int (array element) or None if nothing matches
+        """
+
+    def query_all(
+        self, path: Union[str, NbtPath]
+    ) -> List[Union[CompoundTagVariant, CompoundTag, int]]:
+        """
+        Get every tag matched by a path in /data command syntax, wildcards ([]) and filters ([{Slot:3b}]) may match many tags
+
+        Returns:
+            list of CompoundTagVariant, CompoundTag (empty path) or int (array element)
+        """
+
     def rename(self, old_key: str, new_key: str) -> bool:
         """
         Rename a key in the compound
         """
 
-    def set(self, key: str, value: Any) -> None:
+    def set(self, key: str, value: Any, move: bool = False) -> None:
         """
         Set a value into the compound (automatically converted to appropriate tag type)
+
+        Args:
+            key (str): Key to set
+            value (Any): Value to store
+            move (bool): Move the contents of a tag instead of copying them, leaving it an empty tag of the same type (default: False)
+
+        Throw ValueError if a tag is moved into itself or one of its descendants
         """
 
     def serialize(self, stream: ...) -> None:
@@ -219,6 +310,17 @@ class CompoundTag(Tag):
         Get the size of the compound
         """
 
+    def take(self, key: str) -> Tag:
+        """
+        Remove a key and return its tag without copying it
+        References obtained earlier to or into the removed tag stay valid and refer to the returned tag,
+        an earlier self[key] is left holding an empty tag
+        Throw KeyError if not found
+
+        Returns:
+            Tag
+        """
+
     def to_binary_nbt(self, little_endian: bool = True, header: bool = False) -> bytes:
         """
         Serialize to binary NBT format
@@ -234,6 +336,22 @@ class CompoundTag(Tag):
         Serialize to Network NBT format (used in Minecraft networking)
         """
 
+    def to_python(self, arrays: ArrayFormat = ArrayFormat.BYTES, typed_numbers: bool = False, intern_keys: bool = False) -> Dict[str, Any]:
+        """
+        Convert to plain Python objects (dict, list, int, float, str, bytes) in one native pass
+
+        Args:
+            arrays (ArrayFormat): How byte, int and long arrays are returned
+                (default: BYTES, bytes for byte arrays and array.array otherwise)
+            typed_numbers (bool): Return numbers as ctypes instances (c_uint8, c_int16, c_int32, c_int64, c_float,
+                c_double) so the tag types survive CompoundTag(dict) (default: False)
+            intern_keys (bool): Intern compound keys with sys.intern so they are shared across documents, repeated
+                keys always share one str within a call (default: False)
+
+        Returns:
+            dict
+        """
+
     def values(self) -> list:
         """
         Get list of all values in the compound
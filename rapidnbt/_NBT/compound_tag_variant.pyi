@@ -9,6 +9,7 @@ from typing import overload, List, Any, Dict
 from .snbt_format import SnbtFormat, SnbtNumberFormat
 from .tag_type import TagType
 from .tag import Tag
+from .array_format import ArrayFormat
 
 class CompoundTagVariant:
     """
@@ -229,6 +230,8 @@ class CompoundTagVariant:
     def copy(self) -> Tag:
         """
         Create a deep copy of this tag
+        The whole tree is copied, O(n) in the number of tags, move=True on set() or append() and take()
+        transfer a tag without copying
         """
 
     def get_type(self) -> TagType:
@@ -363,6 +366,22 @@ class CompoundTagVariant:
         Convert tag to JSON string
         """
 
+    def to_python(self, arrays: ArrayFormat = ArrayFormat.BYTES, typed_numbers: bool = False, intern_keys: bool = False) -> Any:
+        """
+        Convert to plain Python objects (dict, list, int, float, str, bytes) in one native pass
+
+        Args:
+            arrays (ArrayFormat): How byte, int and long arrays are returned
+                (default: BYTES, bytes for byte arrays and array.array otherwise)
+            typed_numbers (bool): Return numbers as ctypes instances (c_uint8, c_int16, c_int32, c_int64, c_float,
+                c_double) so the tag types survive CompoundTag(dict) (default: False)
+            intern_keys (bool): Intern compound keys with sys.intern so they are shared across documents, repeated
+                keys always share one str within a call (default: False)
+
+        Returns:
+            dict, list, int, float, str, bytes, array.array or None
+        """
+
     def to_snbt(
         self,
         snbt_format: SnbtFormat = SnbtFormat.Default,
@@ -0,0 +1,206 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from typing import overload, Iterator, List, Tuple, Union
+from .compound_tag import CompoundTag
+from .compound_tag_variant import CompoundTagVariant
+from .list_tag import ListTag
+from .snbt_format import SnbtFormat, SnbtNumberFormat
+from .tag_type import TagType
+
+FrozenValue = Union["FrozenCompoundTag", "FrozenListTag", CompoundTagVariant]
+
+class FrozenCompoundTag:
+    """
+    Immutable compact copy of a CompoundTag returned by CompoundTag.freeze() or nbtio.load(..., frozen=True)
+    Entries are stored contiguously with numbers inline and a hashed key index, the whole tree can be read from many threads
+    """
+
+    def __contains__(self, key: str) -> bool:
+        """
+        Check if key exists in the compound
+        """
+
+    def __getitem__(self, key: str) -> FrozenValue:
+        """
+        Get value by key
+        Compounds and lists stay frozen, other tags are built on access
+        Throw KeyError if not found
+        """
+
+    def __iter__(self) -> Iterator[str]:
+        """
+        Iterate over keys in the compound
+        """
+
+    def __len__(self) -> int:
+        """
+        Get number of key-value pairs
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __str__(self) -> str:
+        """
+        String representation (SNBT minimized format)
+        """
+
+    @overload
+    def contains(self, key: str) -> bool:
+        """
+        Check if key exists
+        """
+
+    @overload
+    def contains(self, key: str, type: TagType) -> bool:
+        """
+        Check if key exists and value type is the specific type
+        """
+
+    def get(self, key: str) -> FrozenValue:
+        """
+        Get value by key
+        Compounds and lists stay frozen, other tags are built on access
+        Throw KeyError if not found
+        """
+
+    def get_byte(self, key: str, signed: bool = False) -> int:
+        """
+        Get the byte value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_double(self, key: str) -> float:
+        """
+        Get the double value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_float(self, key: str) -> float:
+        """
+        Get the float value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_int(self, key: str, signed: bool = True) -> int:
+        """
+        Get the int value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_long(self, key: str, signed: bool = True) -> int:
+        """
+        Get the int64 value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_short(self, key: str, signed: bool = True) -> int:
+        """
+        Get the short value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_string(self, key: str) -> str:
+        """
+        Get the string value at key
+        Throw KeyError if not found, TypeError if wrong type
+        """
+
+    def get_type(self, key: str) -> TagType:
+        """
+        Get the tag type stored at key
+        Throw KeyError if not found
+        """
+
+    def items(self) -> List[Tuple[str, FrozenValue]]:
+        """
+        Get list of (key, value) pairs in the compound
+        """
+
+    def keys(self) -> List[str]:
+        """
+        Get list of all keys in the compound
+        """
+
+    def materialize(self) -> CompoundTag:
+        """
+        Build a mutable CompoundTag copy of the compound
+        """
+
+    def memory_usage(self) -> int:
+        """
+        Get the number of bytes held by the whole frozen document
+        """
+
+    def size(self) -> int:
+        """
+        Get the size of the compound
+        """
+
+    def to_snbt(
+        self,
+        format: SnbtFormat = SnbtFormat.Default,
+        indent: int = 4,
+        number_format: SnbtNumberFormat = SnbtNumberFormat.Decimal,
+    ) -> str:
+        """
+        Convert tag to SNBT string
+        """
+
+    def values(self) -> List[FrozenValue]:
+        """
+        Get list of all values in the compound
+        """
+
+class FrozenListTag:
+    """
+    Read-only list inside a FrozenCompoundTag
+    """
+
+    def __getitem__(self, index: int) -> FrozenValue:
+        """
+        Get element at specified index
+        Compounds and lists stay frozen, other tags are built on access
+        """
+
+    def __len__(self) -> int:
+        """
+        Get number of elements in the list
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __str__(self) -> str:
+        """
+        String representation (SNBT minimized format)
+        """
+
+    def get_element_type(self) -> TagType:
+        """
+        Get the type of elements in this list
+        """
+
+    def materialize(self) -> ListTag:
+        """
+        Build a mutable ListTag copy of the list
+        """
+
+    def size(self) -> int:
+        """
+        Get number of elements in the list
+        """
+
+    def to_list(self) -> List[FrozenValue]:
+        """
+        Get the elements as a list
+        """
@@ -0,0 +1,221 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from typing import overload, Iterator, List, Tuple, Union
+from .byte_array_tag import ByteArrayTag
+from .compound_tag import CompoundTag
+from .compound_tag_variant import CompoundTagVariant
+from .int_array_tag import IntArrayTag
+from .list_tag import ListTag
+from .long_array_tag import LongArrayTag
+from .snbt_format import SnbtFormat, SnbtNumberFormat
+from .tag_type import TagType
+
+LazyValue = Union["LazyCompoundTag", "LazyListTag", "LazyArrayTag", CompoundTagVariant]
+
+class LazyCompoundTag:
+    """
+    Read-only view of a CompoundTag returned by nbtio.load(..., lazy=True)
+    Children are only built when they are accessed
+    """
+
+    def __contains__(self, key: str) -> bool:
+        """
+        Check if key exists in the compound
+        """
+
+    def __getitem__(self, key: str) -> LazyValue:
+        """
+        Get value by key
+        Compounds, lists and arrays stay lazy, other tags are built on access
+        Throw KeyError if not found
+        """
+
+    def __iter__(self) -> Iterator[str]:
+        """
+        Iterate over keys in the compound
+        """
+
+    def __len__(self) -> int:
+        """
+        Get number of key-value pairs
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __str__(self) -> str:
+        """
+        String representation (SNBT minimized format)
+        """
+
+    @overload
+    def contains(self, key: str) -> bool:
+        """
+        Check if key exists
+        """
+
+    @overload
+    def contains(self, key: str, type: TagType) -> bool:
+        """
+        Check if key exists and value type is the specific type
+        """
+
+    def get(self, key: str) -> LazyValue:
+        """
+        Get value by key
+        Compounds, lists and arrays stay lazy, other tags are built on access
+        Throw KeyError if not found
+        """
+
+    def get_type(self, key: str) -> TagType:
+        """
+        Get the tag type stored at key without building it
+        Throw KeyError if not found
+        """
+
+    def items(self) -> List[Tuple[str, LazyValue]]:
+        """
+        Get list of (key, value) pairs in the compound
+        """
+
+    def keys(self) -> List[str]:
+        """
+        Get list of all keys in the compound
+        """
+
+    def materialize(self) -> CompoundTag:
+        """
+        Build the whole subtree as a CompoundTag
+        """
+
+    def size(self) -> int:
+        """
+        Get the size of the compound
+        """
+
+    def to_snbt(
+        self,
+        format: SnbtFormat = SnbtFormat.Default,
+        indent: int = 4,
+        number_format: SnbtNumberFormat = SnbtNumberFormat.Decimal,
+    ) -> str:
+        """
+        Convert tag to SNBT string
+        """
+
+class LazyListTag:
+    """
+    Read-only view of a ListTag inside a LazyCompoundTag
+    """
+
+    def __getitem__(self, index: int) -> LazyValue:
+        """
+        Get element at specified index
+        Compounds, lists and arrays stay lazy, other tags are built on access
+        """
+
+    def __len__(self) -> int:
+        """
+        Get number of elements in the list
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __str__(self) -> str:
+        """
+        String representation (SNBT minimized format)
+        """
+
+    def get_element_type(self) -> TagType:
+        """
+        Get the type of elements in this list
+        """
+
+    def materialize(self) -> ListTag:
+        """
+        Build the whole list as a ListTag
+        """
+
+    def size(self) -> int:
+        """
+        Get number of elements in the list
+        """
+
+    def to_list(self) -> List[LazyValue]:
+        """
+        Get the elements as a list
+        """
+
+class LazyArrayTag:
+    """
+    Byte, int or long array inside a LazyCompoundTag
+    Arrays of little-endian content are read in place without copying
+    Supports the buffer protocol, e.g. memoryview(array) or numpy.asarray(array)
+    """
+
+    def __buffer__(self, flags: int) -> memoryview:
+        """
+        Expose the elements as a buffer (read-only while the array is a view)
+        """
+
+    def __getitem__(self, index: int) -> int:
+        """
+        Get element at index
+        """
+
+    def __len__(self) -> int:
+        """
+        Get number of elements in the array
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __setitem__(self, index: int, value: int) -> None:
+        """
+        Set element at index
+        The view is copied into owned storage on the first write, the write is kept by the parent and included in its materialize()
+        """
+
+    def __str__(self) -> str:
+        """
+        String representation (SNBT minimized format)
+        """
+
+    def get_type(self) -> TagType:
+        """
+        Get the NBT type ID of the array
+        """
+
+    def is_view(self) -> bool:
+        """
+        Check if the array still points into the loaded content
+        The buffer is read-only while it is a view
+        """
+
+    def materialize(self) -> Union[ByteArrayTag, IntArrayTag, LongArrayTag]:
+        """
+        Copy the array into a ByteArrayTag, IntArrayTag or LongArrayTag
+        """
+
+    def size(self) -> int:
+        """
+        Get number of elements in the array
+        """
+
+    def to_list(self) -> List[int]:
+        """
+        Get the elements as a list
+        """
@@ -8,6 +8,7 @@
 from typing import overload, List, Any
 from .compound_tag_variant import CompoundTagVariant
 from .tag import Tag
+from .array_format import ArrayFormat
 from .tag_type import TagType
 
 class ListTag(Tag):
@@ -67,14 +68,16 @@ class ListTag(Tag):
         String representation (SNBT minimized format)
         """
 
-    def append(self, element: Any, check_type: bool = True) -> None:
+    def append(self, element: Any, check_type: bool = True, move: bool = False) -> None:
         """
         Append a Tag element to the list
         Throw TypeError if wrong type and check_type is True
+        Throw ValueError if a tag is moved into itself or one of its descendants
 
         Args:
             value (Any): value append to ListTag
             check_type (bool): check value type is same as the type that ListTag holds
+            move (bool): Move the contents of a tag instead of copying them, leaving it an empty tag of the same type (default: False)
         """
 
     def check_and_fix_list_elements(self) -> bool:
@@ -90,6 +93,8 @@ class ListTag(Tag):
     def copy(self) -> Tag:
         """
         Create a deep copy of this tag
+        The whole tree is copied, O(n) in the number of tags, move=True on set() or append() and take()
+        transfer a tag without copying
         """
 
     def empty(self) -> bool:
@@ -115,6 +120,7 @@ class ListTag(Tag):
     def hash(self) -> int:
         """
         Compute hash value of this tag
+        The whole list is hashed on every call, O(n) in the number of tags
         """
 
     def insert(self, index: int, element: Any, check_type: bool = True) -> None:
@@ -164,6 +170,34 @@ class ListTag(Tag):
         Get number of elements in the list
         """
 
+    def take(self, index: int) -> Tag:
+        """
+        Remove the element at index and return it without copying it
+        References obtained earlier to or into the removed element stay valid and refer to the returned tag,
+        an earlier self[index] is left holding an empty tag
+        Later elements move down one index, so references to them refer to the element now at their index, as with pop()
+        Throw IndexError if out of range
+
+        Returns:
+            Tag
+        """
+
+    def to_python(self, arrays: ArrayFormat = ArrayFormat.BYTES, typed_numbers: bool = False, intern_keys: bool = False) -> List[Any]:
+        """
+        Convert to plain Python objects (dict, list, int, float, str, bytes) in one native pass
+
+        Args:
+            arrays (ArrayFormat): How byte, int and long arrays are returned
+                (default: BYTES, bytes for byte arrays and array.array otherwise)
+            typed_numbers (bool): Return numbers as ctypes instances (c_uint8, c_int16, c_int32, c_int64, c_float,
+                c_double) so the tag types survive ListTag(list) (default: False)
+            intern_keys (bool): Intern compound keys with sys.intern so they are shared across documents, repeated
+                keys always share one str within a call (default: False)
+
+        Returns:
+            list
+        """
+
     def write(self, stream: ...) -> None:
         """
         Write list to a binary stream
@@ -5,6 +5,7 @@
 #
 # SPDX-License-Identifier: MPL-2.0
 
+from collections.abc import Buffer
 from typing import overload, List
 from .tag import Tag
 from .tag_type import TagType
@@ -14,6 +15,12 @@ class LongArrayTag(Tag):
     A tag contains a long array (int64 array)
     """
 
+    def __buffer__(self, flags: int) -> memoryview:
+        """
+        Expose the elements as a writable buffer, e.g. numpy.asarray(tag)
+        The array can not be resized (BufferError) while a view is alive, and views must not outlive the tag
+        """
+
     def __hash__(self) -> int:
         """
         Compute hash value for Python hashing operations
@@ -40,6 +47,13 @@ class LongArrayTag(Tag):
         Construct an empty LongArrayTag
         """
 
+    @overload
+    def __init__(self, buf: Buffer) -> None:
+        """
+        Construct from a buffer of 8-byte integers (e.g. numpy array)
+        Contiguous native integers of the same width are copied with a single memcpy
+        """
+
     @overload
     def __init__(self, values: List[int]) -> None:
         """
@@ -81,6 +95,15 @@ class LongArrayTag(Tag):
         Append an integer to the end of the array
         """
 
+    @overload
+    def assign(self, buf: Buffer) -> LongArrayTag:
+        """
+        Assign new values from a buffer of 8-byte integers (e.g. numpy array)
+        Contiguous native integers of the same width are copied with a single memcpy
+        Returns the modified array
+        """
+
+    @overload
     def assign(self, values: List[int]) -> LongArrayTag:
         """
         Assign new values to the array
@@ -0,0 +1,53 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from enum import Enum
+from typing import Iterator, List, Tuple, Union
+from .nbt_file_format import NbtFileFormat
+from .tag_type import TagType
+
+EventValue = Union[None, int, float, str, bytes, List[int]]
+
+class NbtEventType(Enum):
+    """
+    Events emitted by NbtEventReader
+    """
+
+    BEGIN_COMPOUND = 0
+    END_COMPOUND = 1
+    BEGIN_LIST = 2
+    END_LIST = 3
+    KEY = 4
+    VALUE = 5
+
+class NbtEventReader:
+    """
+    Streaming event parser over binary NBT
+    Use nbtio.iter_events() to create a reader
+    """
+
+    def __iter__(self) -> Iterator[Tuple[NbtEventType, TagType, EventValue]]:
+        """
+        Iterate over the remaining events
+        """
+
+    def __next__(self) -> Tuple[NbtEventType, TagType, EventValue]:
+        """
+        Get the next (event, tag_type, value) tuple
+        value is the key for KEY, the element count for BEGIN_LIST, the tag value for VALUE and None otherwise
+        String values that are not valid UTF-8 are returned as bytes
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def format(self) -> NbtFileFormat:
+        """
+        Get the binary format of the content
+        """
@@ -5,13 +5,14 @@
 #
 # SPDX-License-Identifier: MPL-2.0
 
-from typing import Any, Optional
+from typing import Any, List, Optional
 from pathlib import Path
 from .compound_tag import CompoundTag
 from .nbt_compression_level import NbtCompressionLevel
 from .nbt_compression_type import NbtCompressionType
 from .nbt_file_format import NbtFileFormat
 from .snbt_format import SnbtFormat, SnbtNumberFormat
+from .write_handle import WriteHandle
 
 class NbtFile(CompoundTag):
     """
@@ -26,7 +27,7 @@ class NbtFile(CompoundTag):
 
     def __exit__(self, exc_type: Any, exc_value: Any, traceback: Any) -> None:
         """
-        Exit context manager
+        Exit context manager, saving only if the file was modified
         """
 
     def __repr__(self) -> str:
@@ -39,9 +40,28 @@ class NbtFile(CompoundTag):
         String representation
         """
 
+    def changed_keys(self) -> List[str]:
+        """
+        Get the top-level keys added, changed or removed since the file was opened or last saved
+        """
+
     def flush(self) -> None:
         """
         flush data to the file.
+        Nothing is written if neither the tags nor the file settings changed since the file was opened or last saved
+        """
+
+    def is_modified(self) -> bool:
+        """
+        Check if the tags or file settings changed since the file was opened or last saved
+        """
+
+    def save_async(self) -> WriteHandle:
+        """
+        Save to file_path on the background writer thread
+        The tags are copied before returning, then written to a temporary file, flushed to disk and renamed over the
+        file, so a crash never leaves a truncated file
+        Nothing is written if the file is unmodified, the file only counts as saved once the write succeeded
         """
 
     @property
@@ -0,0 +1,72 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from collections.abc import Buffer
+from typing import List, Tuple, Union
+from .compound_tag import CompoundTag
+from .compound_tag_variant import CompoundTagVariant
+
+class NbtPatchError(ValueError):
+    """
+    Raised when a patch is malformed or does not fit the compound it is applied to
+    """
+
+class NbtPatch:
+    """
+    Edits turning one CompoundTag into another, created by CompoundTag.diff()
+    Each edit sets or removes the tag at an NbtPath made of keys and indices, or splices a range of a list or array
+    """
+
+    @staticmethod
+    def from_binary(data: Buffer, little_endian: bool = True) -> NbtPatch:
+        """
+        Read a patch serialized with to_binary()
+        Throw NbtPatchError (a ValueError) if the data is not a patch
+        """
+
+    @staticmethod
+    def from_tag(tag: CompoundTag) -> NbtPatch:
+        """
+        Read a patch stored with to_tag()
+        Throw NbtPatchError (a ValueError) if the tag is not a patch
+        """
+
+    def __len__(self) -> int:
+        """
+        Number of edits
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def operations(
+        self,
+    ) -> List[
+        Union[
+            Tuple[str, str, CompoundTagVariant],
+            Tuple[str, str],
+            Tuple[str, str, CompoundTagVariant, int, int],
+        ]
+    ]:
+        """
+        Get the edits as tuples
+
+        Returns:
+            list of ("set", path, value), ("remove", path) and ("splice", path, elements, offset, removed)
+        """
+
+    def to_binary(self, little_endian: bool = True) -> bytes:
+        """
+        Serialize the patch to binary NBT
+        """
+
+    def to_tag(self) -> CompoundTag:
+        """
+        Store the patch as a CompoundTag {ops: [{op, path, value, offset, removed}, ...]}
+        """
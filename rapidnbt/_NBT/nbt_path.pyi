@@ -0,0 +1,69 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from typing import List, Optional, Union
+from .compound_tag import CompoundTag
+from .compound_tag_variant import CompoundTagVariant
+
+PathMatch = Union[CompoundTagVariant, CompoundTag, int]
+
+class NbtPathError(ValueError):
+    """
+    Raised when a path is malformed
+    """
+
+class NbtPath:
+    """
+    Compiled NBT path in the syntax of the Java Edition /data command
+    Supports keys (quoted or not), indices (negative from the end), wildcards ([]) and compound filters ({...} and [{...}])
+    """
+
+    def __init__(self, path: str) -> None:
+        """
+        Compile a path
+
+        Example:
+            NbtPath("Items[{Slot:3b}].tag.display.Name")
+            NbtPath("Level.Sections[].Y")
+
+        Throw NbtPathError (a ValueError) if the path is malformed
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __str__(self) -> str:
+        """
+        The path text
+        """
+
+    def query(self, nbt: CompoundTag) -> Optional[PathMatch]:
+        """
+        Get the first tag matched by the path
+        Array elements are returned as int
+
+        Returns:
+            CompoundTagVariant, CompoundTag (empty path), int or None if nothing matches
+        """
+
+    def query_all(self, nbt: CompoundTag) -> List[PathMatch]:
+        """
+        Get every tag matched by the path
+
+        Returns:
+            list of CompoundTagVariant, CompoundTag (empty path) or int
+        """
+
+    def query_each(self, tags: List[CompoundTag]) -> List[Optional[PathMatch]]:
+        """
+        Get the first tag matched by the path in each of many tags in one call
+
+        Returns:
+            list of matches (None where nothing matches) in input order
+        """
@@ -0,0 +1,40 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from typing import Dict, List, Union
+from .tag_type import TagType
+
+SchemaType = Union[TagType, str, Dict[str, "SchemaType"], List["SchemaType"]]
+
+class NbtSchema:
+    """
+    Tag types for building typed tags from plain Python values
+    Plain values under a typed key are converted straight to that type, keys the schema does not mention are inferred as
+    in CompoundTag(dict), and values that are already tags are kept as they are
+    """
+
+    def __init__(self, schema: Dict[str, SchemaType]) -> None:
+        """
+        Compile a schema mapping keys to tag types
+        A type is a TagType, its name as str, a dict for a nested compound or a list with one element type (an empty
+        list or TagType.List leaves the elements inferred)
+
+        Example:
+            NbtSchema({"Pos": "List[Double]", "Health": TagType.Short, "UUID": TagType.IntArray, "Attributes": [{"Base": TagType.Double}]})
+
+        Throw TypeError or ValueError if the schema is malformed
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def __str__(self) -> str:
+        """
+        The schema in string form, e.g. {Health: Short, Pos: List[Double]}
+        """
@@ -7,13 +7,18 @@
 
 import os
 from collections.abc import Buffer
-from typing import Optional
+from typing import overload, List, Literal, Optional, Union
 from .compound_tag import CompoundTag
+from .frozen_compound_tag import FrozenCompoundTag
+from .lazy_compound_tag import LazyCompoundTag
+from .nbt_event_reader import NbtEventReader
 from .snbt_format import SnbtFormat, SnbtNumberFormat
 from .nbt_file_format import NbtFileFormat
 from .nbt_compression_level import NbtCompressionLevel
 from .nbt_compression_type import NbtCompressionType
+from .inflate_backend import InflateBackend
 from .nbt_file import NbtFile
+from .write_handle import WriteHandle
 
 def detect_content_format(
     content: Buffer, strict_match_size: bool = True
@@ -81,6 +86,8 @@ def dump(
     format: NbtFileFormat = NbtFileFormat.LITTLE_ENDIAN,
     compression_type: NbtCompressionType = NbtCompressionType.GZIP,
     compression_level: NbtCompressionLevel = NbtCompressionLevel.DEFAULT,
+    header_version: Optional[int] = None,
+    compression_threads: int = 1,
 ) -> bool:
     """
     Save CompoundTag to a file
@@ -91,12 +98,42 @@ def dump(
         format (NbtFileFormat): Output format (default: LITTLE_ENDIAN)
         compression_type (CompressionType): Compression method (default: Gzip)
         compression_level (CompressionLevel): Compression level (default: Default)
+        header_version (Optional[int]): NBT header storage version
+        compression_threads (int): Compress blocks on this many threads, 0 for one per CPU (default: 1)
 
     Returns:
         bool: True if successful, False otherwise
 
     """
 
+def dump_async(
+    nbt: CompoundTag,
+    path: os.PathLike,
+    format: NbtFileFormat = NbtFileFormat.LITTLE_ENDIAN,
+    compression_type: NbtCompressionType = NbtCompressionType.GZIP,
+    compression_level: NbtCompressionLevel = NbtCompressionLevel.DEFAULT,
+    header_version: Optional[int] = None,
+    compression_threads: int = 1,
+) -> WriteHandle:
+    """
+    Save CompoundTag to a file on the background writer thread
+    The tag is copied before returning, then serialized, compressed, written to a temporary file, flushed to disk and
+    renamed over path, so a crash never leaves a truncated file
+    A queued save of the same path that has not started yet is replaced by this one
+
+    Args:
+        nbt (CompoundTag): Tag to save
+        path (os.PathLike): Output file path
+        format (NbtFileFormat): Output format (default: LITTLE_ENDIAN)
+        compression_type (CompressionType): Compression method (default: Gzip)
+        compression_level (CompressionLevel): Compression level (default: Default)
+        header_version (Optional[int]): NBT header storage version
+        compression_threads (int): Compress blocks on this many threads, 0 for one per CPU (default: 1)
+
+    Returns:
+        WriteHandle
+    """
+
 def dump_snbt(
     nbt: CompoundTag,
     path: os.PathLike,
@@ -123,6 +160,8 @@ def dumps(
     format: NbtFileFormat = NbtFileFormat.LITTLE_ENDIAN,
     compression_type: NbtCompressionType = NbtCompressionType.GZIP,
     compression_level: NbtCompressionLevel = NbtCompressionLevel.DEFAULT,
+    header_version: Optional[int] = None,
+    compression_threads: int = 1,
 ) -> bytes:
     """
     Serialize CompoundTag to binary data
@@ -132,6 +171,8 @@ def dumps(
         format (NbtFileFormat): Output format (default: LITTLE_ENDIAN)
         compression_type (CompressionType): Compression method (default: Gzip)
         compression_level (CompressionLevel): Compression level (default: Default)
+        header_version (Optional[int]): NBT header storage version
+        compression_threads (int): Compress blocks on this many threads, 0 for one per CPU (default: 1)
 
     Returns:
         bytes: Serialized binary data
@@ -161,6 +202,8 @@ def dumps_base64(
     format: NbtFileFormat = NbtFileFormat.LITTLE_ENDIAN,
     compression_type: NbtCompressionType = NbtCompressionType.GZIP,
     compression_level: NbtCompressionLevel = NbtCompressionLevel.DEFAULT,
+    header_version: Optional[int] = None,
+    compression_threads: int = 1,
 ) -> str:
     """
     Serialize CompoundTag to Base64 string
@@ -170,17 +213,60 @@ def dumps_base64(
         format (NbtFileFormat): Output format (default: LITTLE_ENDIAN)
         compression_type (CompressionType): Compression method (default: Gzip)
         compression_level (CompressionLevel): Compression level (default: Default)
+        header_version (Optional[int]): NBT header storage version
+        compression_threads (int): Compress blocks on this many threads, 0 for one per CPU (default: 1)
 
     Returns:
         str: Base64-encoded NBT data
 
     """
 
+def get_inflate_backend() -> InflateBackend:
+    """
+    Get the decompressor used by the parse functions
+
+    Returns:
+        InflateBackend
+    """
+
+def is_inflate_backend_available(backend: InflateBackend) -> bool:
+    """
+    Check if a decompressor is available in this build
+
+    Args:
+        backend (InflateBackend): Backend to check
+
+    Returns:
+        bool
+    """
+
+def iter_events(
+    source: Union[os.PathLike, Buffer],
+    format: Optional[NbtFileFormat] = None,
+    file_memory_map: bool = False,
+) -> Optional[NbtEventReader]:
+    """
+    Stream binary NBT as (event, tag_type, value) tuples without building tags
+    Compressed files are inflated on the fly in constant memory
+
+    Args:
+        source (os.PathLike | Buffer): Path to NBT file or binary content
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        file_memory_map (bool): Use memory mapping for files (default: False)
+
+    Returns:
+        NbtEventReader or None if the source can not be opened
+    """
+
+@overload
 def load(
     path: os.PathLike,
     format: Optional[NbtFileFormat] = None,
     file_memory_map: bool = False,
     strict_match_size: bool = True,
+    lazy: Literal[False] = False,
+    include: Optional[List[str]] = None,
+    frozen: Literal[False] = False,
 ) -> Optional[CompoundTag]:
     """
     Parse CompoundTag from a file
@@ -190,11 +276,87 @@ def load(
         format (NbtFileFormat, optional): Force specific format (autodetect if None)
         file_memory_map (bool): Use memory mapping for large files (default: False)
         strict_match_size (bool): Strictly match nbt content size (default: True)
+        lazy (bool): Only index the file and build tags on access (default: False)
+        include (list[str], optional): Only build these key paths, e.g. ["Data.Player", "Data.LevelName"]
+            (default: None, everything). Other subtrees are skipped without building tags
 
     Returns:
         CompoundTag or None if parsing fails
     """
 
+@overload
+def load(
+    path: os.PathLike,
+    format: Optional[NbtFileFormat] = None,
+    file_memory_map: bool = False,
+    strict_match_size: bool = True,
+    lazy: Literal[True] = ...,
+    include: None = None,
+    frozen: Literal[False] = False,
+) -> Optional[LazyCompoundTag]:
+    """
+    Index a file without building the tag tree
+    Arrays are returned as LazyArrayTag, which reads uncompressed little-endian
+    content in place (straight from the mapping with file_memory_map=True)
+
+    Args:
+        path (os.PathLike): Path to NBT file
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        file_memory_map (bool): Use memory mapping for large files (default: False)
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        lazy (bool): Only index the file and build tags on access (default: False)
+
+    Returns:
+        LazyCompoundTag or None if parsing fails
+    """
+
+@overload
+def load(
+    path: os.PathLike,
+    format: Optional[NbtFileFormat] = None,
+    file_memory_map: bool = False,
+    strict_match_size: bool = True,
+    lazy: Literal[False] = False,
+    include: Optional[List[str]] = None,
+    frozen: Literal[True] = ...,
+) -> Optional[FrozenCompoundTag]:
+    """
+    Parse a file into an immutable compact FrozenCompoundTag for read-mostly data
+
+    Args:
+        path (os.PathLike): Path to NBT file
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        file_memory_map (bool): Use memory mapping for large files (default: False)
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        lazy (bool): Can not be combined with frozen (default: False)
+        include (list[str], optional): Only keep these key paths (default: None, everything)
+        frozen (bool): Return a FrozenCompoundTag (default: False)
+
+    Returns:
+        FrozenCompoundTag or None if parsing fails
+    """
+
+def load_many(
+    paths: List[os.PathLike],
+    format: Optional[NbtFileFormat] = None,
+    file_memory_map: bool = False,
+    strict_match_size: bool = True,
+    threads: int = 0,
+) -> List[Optional[CompoundTag]]:
+    """
+    Read, decompress and parse many files in parallel
+
+    Args:
+        paths (list[os.PathLike]): Paths to NBT files
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        file_memory_map (bool): Use memory mapping for large files (default: False)
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        threads (int): Number of worker threads (default: 0, one per CPU)
+
+    Returns:
+        list of CompoundTag (None for entries that fail to load) in input order
+    """
+
 def load_snbt(path: os.PathLike) -> Optional[CompoundTag]:
     """
     Parse CompoundTag from SNBT (String NBT) file
@@ -206,10 +368,14 @@ def load_snbt(path: os.PathLike) -> Optional[CompoundTag]:
         CompoundTag or None if parsing fails
     """
 
+@overload
 def loads(
     content: Buffer,
     format: Optional[NbtFileFormat] = None,
     strict_match_size: bool = True,
+    lazy: Literal[False] = False,
+    include: Optional[List[str]] = None,
+    frozen: Literal[False] = False,
 ) -> Optional[CompoundTag]:
     """
     Parse CompoundTag from binary data
@@ -218,15 +384,85 @@ def loads(
         content (bytes): Binary NBT data
         format (NbtFileFormat, optional): Force specific format (autodetect if None)
         strict_match_size (bool): Strictly match nbt content size (default: True)
+        lazy (bool): Only index the content and build tags on access (default: False)
+        include (list[str], optional): Only build these key paths, e.g. ["Data.Player"]
+            (default: None, everything). Other subtrees are skipped without building tags
 
     Returns:
         CompoundTag or None if parsing fails
     """
 
+@overload
+def loads(
+    content: Buffer,
+    format: Optional[NbtFileFormat] = None,
+    strict_match_size: bool = True,
+    lazy: Literal[True] = ...,
+    include: None = None,
+    frozen: Literal[False] = False,
+) -> Optional[LazyCompoundTag]:
+    """
+    Index binary data without building the tag tree
+
+    Args:
+        content (bytes): Binary NBT data
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        lazy (bool): Only index the content and build tags on access (default: False)
+
+    Returns:
+        LazyCompoundTag or None if parsing fails
+    """
+
+@overload
+def loads(
+    content: Buffer,
+    format: Optional[NbtFileFormat] = None,
+    strict_match_size: bool = True,
+    lazy: Literal[False] = False,
+    include: Optional[List[str]] = None,
+    frozen: Literal[True] = ...,
+) -> Optional[FrozenCompoundTag]:
+    """
+    Parse binary data into an immutable compact FrozenCompoundTag for read-mostly data
+
+    Args:
+        content (bytes): Binary NBT data
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        lazy (bool): Can not be combined with frozen (default: False)
+        include (list[str], optional): Only keep these key paths (default: None, everything)
+        frozen (bool): Return a FrozenCompoundTag (default: False)
+
+    Returns:
+        FrozenCompoundTag or None if parsing fails
+    """
+
+def loads_batch(
+    contents: List[Buffer],
+    format: NbtFileFormat,
+    strict_match_size: bool = True,
+    threads: int = 1,
+) -> List[Optional[CompoundTag]]:
+    """
+    Parse many small uncompressed binary NBT values of one known format in a single call
+    No format or compression detection is done, which suits values read from a LevelDB database
+
+    Args:
+        contents (list[Buffer]): Binary NBT data
+        format (NbtFileFormat): Format of every value
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        threads (int): Number of worker threads (default: 1, 0 for one per CPU)
+
+    Returns:
+        list of CompoundTag (None for entries that fail to parse) in input order
+    """
+
 def loads_base64(
     content: str,
     format: Optional[NbtFileFormat] = None,
     strict_match_size: bool = True,
+    strict_base64: bool = False,
 ) -> Optional[CompoundTag]:
     """
     Parse CompoundTag from Base64-encoded NBT
@@ -235,9 +471,11 @@ def loads_base64(
         content (str): Base64-encoded NBT data
         format (NbtFileFormat, optional): Force specific format (autodetect if None)
         strict_match_size (bool): Strictly match nbt content size (default: True)
+        strict_base64 (bool): Only accept RFC 4648 Base64 with the standard alphabet and padding, instead of also
+            skipping whitespace and accepting the URL-safe alphabet and missing padding (default: False)
 
     Returns:
-        CompoundTag or None if parsing fails
+        CompoundTag or None if the Base64 is malformed or parsing fails
     """
 
 def loads_json(
@@ -253,6 +491,25 @@ def loads_json(
         CompoundTag or None if parsing fails
     """
 
+def loads_many(
+    contents: List[Buffer],
+    format: Optional[NbtFileFormat] = None,
+    strict_match_size: bool = True,
+    threads: int = 0,
+) -> List[Optional[CompoundTag]]:
+    """
+    Parse many binary NBT buffers in parallel
+
+    Args:
+        contents (list[Buffer]): Binary NBT data
+        format (NbtFileFormat, optional): Force specific format (autodetect if None)
+        strict_match_size (bool): Strictly match nbt content size (default: True)
+        threads (int): Number of worker threads (default: 0, one per CPU)
+
+    Returns:
+        list of CompoundTag (None for entries that fail to parse) in input order
+    """
+
 def loads_snbt(
     content: str, parsed_length: Optional[int] = None
 ) -> Optional[CompoundTag]:
@@ -277,6 +534,15 @@ def open(path: os.PathLike) -> Optional[NbtFile]:
         Optional[NbtFile]: NbtFile or None if open failed
     """
 
+def set_inflate_backend(backend: InflateBackend) -> None:
+    """
+    Select the decompressor used by load, loads, loads_base64 and the batch loaders
+    Raise ValueError if the backend is not available in this build
+
+    Args:
+        backend (InflateBackend): ZLIB or LIBDEFLATE (whole-buffer inflate, default when available)
+    """
+
 def validate_content(
     content: Buffer,
     format: NbtFileFormat = NbtFileFormat.LITTLE_ENDIAN,
@@ -312,3 +578,8 @@ def validate_file(
     Returns:
         bool: True if valid NBT file, False otherwise
     """
+
+def wait_writes() -> None:
+    """
+    Block until every save queued by dump_async and NbtFile.save_async has finished
+    """
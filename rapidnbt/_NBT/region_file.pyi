@@ -0,0 +1,153 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+from typing import Dict, List, Optional, Tuple
+from .compound_tag import CompoundTag
+from .nbt_compression_level import NbtCompressionLevel
+from .nbt_compression_type import NbtCompressionType
+
+class RegionFile:
+    """
+    Anvil region file (.mca) of Java Edition worlds
+    Chunk coordinates are taken modulo 32, so region-local and world chunk coordinates are both accepted
+    """
+
+    def __contains__(self, coord: Tuple[int, int]) -> bool:
+        """
+        Check if the chunk at (x, z) exists
+        """
+
+    def __init__(self) -> None:
+        """
+        Construct an empty region
+        """
+
+    def __len__(self) -> int:
+        """
+        Get number of stored chunks
+        """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def chunk_coords(self) -> List[Tuple[int, int]]:
+        """
+        Get the region-local (x, z) coordinates of every stored chunk
+        """
+
+    def get_timestamp(self, x: int, z: int) -> Optional[int]:
+        """
+        Get the last modification time of the chunk in epoch seconds
+
+        Returns:
+            int or None if the chunk does not exist
+        """
+
+    def has_chunk(self, x: int, z: int) -> bool:
+        """
+        Check if the chunk exists
+        """
+
+    @staticmethod
+    def open(path: os.PathLike, file_memory_map: bool = False) -> Optional[RegionFile]:
+        """
+        Open a region file
+        Chunks are only decompressed and parsed when they are read
+
+        Args:
+            path (os.PathLike): Path to the .mca file
+            file_memory_map (bool): Use memory mapping for large files (default: False)
+
+        Returns:
+            RegionFile or None if the file cannot be read
+        """
+
+    def read_chunk(self, x: int, z: int) -> Optional[CompoundTag]:
+        """
+        Decompress and parse one chunk
+
+        Returns:
+            CompoundTag or None if the chunk does not exist or cannot be parsed
+        """
+
+    def read_chunks(
+        self, coords: Optional[List[Tuple[int, int]]] = None, threads: int = 0
+    ) -> Dict[Tuple[int, int], Optional[CompoundTag]]:
+        """
+        Decompress and parse chunks in parallel
+
+        Args:
+            coords (list[tuple[int, int]], optional): Chunks to read (default: None, every stored chunk)
+            threads (int): Number of worker threads (default: 0, one per CPU)
+
+        Returns:
+            dict of (x, z) to CompoundTag (None for chunks that do not exist or cannot be parsed)
+        """
+
+    def remove_chunk(self, x: int, z: int) -> bool:
+        """
+        Remove a chunk
+
+        Returns:
+            True if the chunk existed
+        """
+
+    def save(self, path: os.PathLike) -> bool:
+        """
+        Write the region to a file
+        Chunks are packed into 4 KiB sectors from sector 2 onwards, chunks larger than 255 sectors are written to
+        c.<x>.<z>.mcc files next to the region
+
+        Args:
+            path (os.PathLike): Output file path
+
+        Returns:
+            True if successful
+        """
+
+    def write_chunk(
+        self,
+        x: int,
+        z: int,
+        nbt: CompoundTag,
+        compression_type: NbtCompressionType = NbtCompressionType.ZLIB,
+        compression_level: NbtCompressionLevel = NbtCompressionLevel.DEFAULT,
+        timestamp: Optional[int] = None,
+    ) -> None:
+        """
+        Serialize and store one chunk
+
+        Args:
+            x (int): Chunk x coordinate
+            z (int): Chunk z coordinate
+            nbt (CompoundTag): Chunk data
+            compression_type (NbtCompressionType): Compression method (default: Zlib)
+            compression_level (NbtCompressionLevel): Compression level (default: Default)
+            timestamp (int, optional): Modification time in epoch seconds (default: None, now)
+        """
+
+    def write_chunks(
+        self,
+        chunks: Dict[Tuple[int, int], CompoundTag],
+        compression_type: NbtCompressionType = NbtCompressionType.ZLIB,
+        compression_level: NbtCompressionLevel = NbtCompressionLevel.DEFAULT,
+        timestamp: Optional[int] = None,
+        threads: int = 0,
+    ) -> None:
+        """
+        Serialize and compress chunks in parallel
+
+        Args:
+            chunks (dict[tuple[int, int], CompoundTag]): Chunk data by (x, z)
+            compression_type (NbtCompressionType): Compression method (default: Zlib)
+            compression_level (NbtCompressionLevel): Compression level (default: Default)
+            timestamp (int, optional): Modification time in epoch seconds (default: None, now)
+            threads (int): Number of worker threads (default: 0, one per CPU)
+        """
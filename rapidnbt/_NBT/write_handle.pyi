@@ -0,0 +1,50 @@
+# Copyright © 2025 GlacieTeam.All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy
+# of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from pathlib import Path
+from typing import Optional
+
+class WriteHandle:
+    """
+    Result of a background write
+    Saves of the same path that were coalesced share one handle result
+    """
+
+    def __repr__(self) -> str:
+        """
+        Official string representation
+        """
+
+    def done(self) -> bool:
+        """
+        Check if the write has finished
+        """
+
+    def result(self) -> bool:
+        """
+        Wait for the write to finish and get its result
+
+        Returns:
+            True if the file was written and renamed into place
+        """
+
+    def wait(self, timeout: Optional[float] = None) -> bool:
+        """
+        Wait for the write to finish
+
+        Args:
+            timeout (Optional[float]): Maximum seconds to wait (default: None, no limit)
+
+        Returns:
+            True if the write has finished
+        """
+
+    @property
+    def path(self) -> Path:
+        """
+        Path of the file being written
+        """
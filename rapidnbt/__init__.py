@@ -24,10 +24,20 @@ from ._NBT.list_tag import ListTag
 from ._NBT.compound_tag import CompoundTag
 from ._NBT.int_array_tag import IntArrayTag
 from ._NBT.long_array_tag import LongArrayTag
+from ._NBT.nbt_path import NbtPath, NbtPathError
+from ._NBT.nbt_schema import NbtSchema
+from ._NBT.nbt_patch import NbtPatch, NbtPatchError
+from ._NBT.lazy_compound_tag import LazyCompoundTag, LazyListTag, LazyArrayTag
+from ._NBT.frozen_compound_tag import FrozenCompoundTag, FrozenListTag
+from ._NBT.nbt_event_reader import NbtEventType, NbtEventReader
+from ._NBT.region_file import RegionFile
 from ._NBT.nbt_file_format import NbtFileFormat
 from ._NBT.nbt_compression_level import NbtCompressionLevel
 from ._NBT.nbt_compression_type import NbtCompressionType
+from ._NBT.inflate_backend import InflateBackend
+from ._NBT.array_format import ArrayFormat
 from ._NBT.nbt_file import NbtFile
+from ._NBT.write_handle import WriteHandle
 from ._NBT import nbtio
 
 __all__ = [
@@ -49,9 +59,25 @@ __all__ = [
     "CompoundTag",
     "IntArrayTag",
     "LongArrayTag",
+    "NbtPath",
+    "NbtPathError",
+    "NbtSchema",
+    "NbtPatch",
+    "NbtPatchError",
+    "LazyCompoundTag",
+    "LazyListTag",
+    "LazyArrayTag",
+    "FrozenCompoundTag",
+    "FrozenListTag",
+    "NbtEventType",
+    "NbtEventReader",
+    "RegionFile",
     "nbtio",
     "NbtCompressionLevel",
     "NbtCompressionType",
+    "InflateBackend",
+    "ArrayFormat",
     "NbtFileFormat",
     "NbtFile",
+    "WriteHandle",
 ]
@@ -65,6 +65,8 @@ class XMakeBuild(build_ext):
         if sys.platform == "win32":
             intalll_dir = sysconfig.get_config_var("installed_base")
             command.append(f"--pylinkdir={intalll_dir}\\libs")
+        if os.environ.get("RAPIDNBT_LIBDEFLATE", "1") == "0":
+            command.append("--libdeflate=n")
         command += [
             f"--arch={self.get_arch()}",
             "-y",
@@ -0,0 +1,46 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from rapidnbt import ByteArrayTag, IntArrayTag, LongArrayTag
+
+
+def expect_buffer_error(action):
+    try:
+        action()
+    except BufferError as error:
+        return str(error)
+    raise AssertionError("resize was not blocked")
+
+
+def main():
+    for tag in (ByteArrayTag(bytes(range(8))), IntArrayTag(list(range(8))), LongArrayTag(list(range(8)))):
+        view = memoryview(tag)
+        view[0] = 42
+        assert tag[0] == 42 and tag.size() == 8
+
+        # Views point at the storage, so anything that could move it is refused while one is alive
+        print(expect_buffer_error(lambda: tag.append(1)))
+        for action in (lambda: tag.pop(0), lambda: tag.pop(0, 2), lambda: tag.clear(), lambda: tag.reserve(1024)):
+            expect_buffer_error(action)
+        assert tag.size() == 8 and view[0] == 42
+
+        view.release()
+        tag.append(9)
+        assert tag.size() == 9 and tag[8] == 9
+
+    tag = ByteArrayTag(b"abc")
+    data = tag.data()
+    data[1] = ord("x")
+    assert bytes(tag) == b"axc"
+    expect_buffer_error(lambda: tag.assign(b"longer"))
+    del data
+    tag.assign(b"longer")
+    assert bytes(tag) == b"longer"
+
+
+if __name__ == "__main__":
+    main()
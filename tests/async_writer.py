@@ -0,0 +1,79 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import shutil
+import time
+import tempfile
+from rapidnbt import nbtio, CompoundTag, LongArrayTag
+
+
+def make_world(tick: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "Tick": tick,
+            "Players": [{"Name": f"player{index}", "Pos": [index * 1.5, 64.0, -index * 1.5]} for index in range(500)],
+            "Heightmap": LongArrayTag(list(range(tick, tick + 4096))),
+        }
+    )
+
+
+def main():
+    with tempfile.TemporaryDirectory() as folder:
+        path = os.path.join(folder, "world.dat")
+
+        start = time.perf_counter()
+        for tick in range(100):
+            assert nbtio.dump(make_world(tick), path)
+        blocking = time.perf_counter() - start
+
+        start = time.perf_counter()
+        handles = [nbtio.dump_async(make_world(tick), path) for tick in range(100)]
+        queued = time.perf_counter() - start
+        assert all(handle.result() for handle in handles)
+        print(f"100 saves: dump {blocking:.3f}s, dump_async {queued:.3f}s on the calling thread")
+        print(handles[-1])
+        assert nbtio.load(path)["Tick"].get_int() == 99
+        assert os.listdir(folder) == ["world.dat"]
+
+        with nbtio.open(path) as file:
+            assert file.save_async().result()
+            file["Tick"] = 100
+            handle = file.save_async()
+            assert handle.wait(timeout=10.0) and handle.result()
+        nbtio.wait_writes()
+        assert nbtio.load(path)["Tick"].get_int() == 100
+
+        # SNBT files are written back as SNBT
+        snbt_path = os.path.join(folder, "world.snbt")
+        assert nbtio.dump_snbt(make_world(0), snbt_path)
+        with nbtio.open(snbt_path) as file:
+            assert file.is_snbt
+            file["Tick"] = 7
+            assert file.save_async().result()
+        assert nbtio.load_snbt(snbt_path)["Tick"].get_int() == 7
+        os.remove(snbt_path)
+
+        handle = nbtio.dump_async(make_world(0), os.path.join(folder, "missing", "world.dat"))
+        assert not handle.result()
+
+        # A failed background save leaves the file modified, so the next flush writes it again
+        subfolder = os.path.join(folder, "sub")
+        os.mkdir(subfolder)
+        assert nbtio.dump(make_world(0), os.path.join(subfolder, "world.dat"))
+        file = nbtio.open(os.path.join(subfolder, "world.dat"))
+        file["Tick"] = 1
+        shutil.rmtree(subfolder)
+        assert not file.save_async().result()
+        assert file.is_modified() and file.changed_keys() == ["Tick"]
+        os.mkdir(subfolder)
+        file.flush()
+        assert not file.is_modified() and nbtio.load(os.path.join(subfolder, "world.dat"))["Tick"].get_int() == 1
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,35 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from rapidnbt import nbtio, CompoundTag, LongArrayTag, NbtCompressionType
+
+
+def main():
+    nbt = CompoundTag({"Name": "chunk", "BlockStates": LongArrayTag(list(range(256))), "Palette": [{"Name": "minecraft:stone"}]})
+
+    # Both the library encoder and the block-parallel one decode back to the same tree
+    for compression_type in NbtCompressionType:
+        for threads in (1, 2):
+            encoded = nbtio.dumps_base64(nbt, compression_type=compression_type, compression_threads=threads)
+            assert nbtio.loads_base64(encoded) == nbt
+            assert nbtio.loads_base64(encoded, strict_base64=True) == nbt
+
+    # Line-wrapped, whitespace-padded, unpadded and URL-safe input is accepted by default
+    encoded = nbtio.dumps_base64(nbt)
+    wrapped = "\n".join(encoded[index : index + 76] for index in range(0, len(encoded), 76)) + "\n"
+    url_safe = encoded.translate(str.maketrans("+/", "-_"))
+    for variant in (wrapped, f"  {encoded}\r\n", encoded.rstrip("="), url_safe):
+        assert nbtio.loads_base64(variant) == nbt
+
+    # strict_base64 only accepts canonical RFC 4648 input
+    for malformed in (encoded[:-1], encoded + "=", " " + encoded, wrapped, encoded[:4] + "-" + encoded[5:], encoded[:8] + "=" + encoded[9:]):
+        assert nbtio.loads_base64(malformed, strict_base64=True) is None
+    assert nbtio.loads_base64("not base64!") is None
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,96 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+"""Deterministic synthetic corpora, every shape is generated from a fixed seed"""
+
+import random
+from rapidnbt import CompoundTag, ListTag, ByteArrayTag, IntArrayTag, LongArrayTag, ByteTag, ShortTag, LongTag, FloatTag
+
+
+def chunk(rng: random.Random, index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "xPos": index % 32,
+            "zPos": index // 32,
+            "LastUpdate": LongTag(rng.getrandbits(40)),
+            "Status": "minecraft:full",
+            "Heightmaps": {
+                "MOTION_BLOCKING": LongArrayTag([rng.getrandbits(63) for _ in range(37)]),
+                "WORLD_SURFACE": LongArrayTag([rng.getrandbits(63) for _ in range(37)]),
+            },
+            "sections": [
+                {
+                    "Y": ByteTag(y),
+                    "block_states": {
+                        "palette": [{"Name": f"minecraft:block_{rng.randrange(512)}"} for _ in range(rng.randrange(1, 16))],
+                        "data": LongArrayTag([rng.getrandbits(63) for _ in range(256)]),
+                    },
+                    "BlockLight": ByteArrayTag(rng.randbytes(2048)),
+                }
+                for y in range(-4, 20)
+            ],
+            "block_entities": [
+                {"id": "minecraft:chest", "x": rng.randrange(16), "y": rng.randrange(-64, 320), "z": rng.randrange(16), "Items": []}
+                for _ in range(rng.randrange(4))
+            ],
+        }
+    )
+
+
+def player(rng: random.Random, index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "Name": f"player_{index}",
+            "UUID": IntArrayTag([rng.getrandbits(31) for _ in range(4)]),
+            "Pos": [rng.uniform(-3e4, 3e4), rng.uniform(-64, 320), rng.uniform(-3e4, 3e4)],
+            "Rotation": ListTag([FloatTag(rng.uniform(-180, 180)), FloatTag(rng.uniform(-90, 90))]),
+            "Health": FloatTag(20.0),
+            "XpLevel": rng.randrange(100),
+            "Inventory": [
+                {
+                    "Slot": ByteTag(slot),
+                    "id": f"minecraft:item_{rng.randrange(1024)}",
+                    "Count": ByteTag(rng.randrange(1, 65)),
+                    "Damage": ShortTag(rng.randrange(1000)),
+                    "tag": {"display": {"Name": f"item {slot}"}, "Enchantments": [{"id": "minecraft:sharpness", "lvl": ShortTag(5)}]},
+                }
+                for slot in range(36)
+            ],
+            "abilities": {"flying": ByteTag(0), "mayfly": ByteTag(0), "walkSpeed": FloatTag(0.1)},
+        }
+    )
+
+
+def nested(rng: random.Random, depth: int) -> CompoundTag:
+    node = CompoundTag({"leaf": rng.getrandbits(31)})
+    for level in range(depth):
+        node = CompoundTag({"level": level, "name": f"node_{level}", "child": node, "siblings": [rng.getrandbits(31) for _ in range(4)]})
+    return node
+
+
+def arrays(rng: random.Random, index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "bytes": ByteArrayTag(rng.randbytes(65536)),
+            "ints": IntArrayTag([rng.getrandbits(31) for _ in range(16384)]),
+            "longs": LongArrayTag([rng.getrandbits(63) for _ in range(8192)]),
+            "index": index,
+        }
+    )
+
+
+# name -> builder(scale) returning the root CompoundTag
+CORPORA = {
+    "chunk": lambda rng, scale: CompoundTag({"chunks": [chunk(rng, index) for index in range(max(1, int(64 * scale)))]}),
+    "player": lambda rng, scale: CompoundTag({"players": [player(rng, index) for index in range(max(1, int(256 * scale)))]}),
+    "nested": lambda rng, scale: CompoundTag({"trees": [nested(rng, 256) for _ in range(max(1, int(16 * scale)))]}),
+    "arrays": lambda rng, scale: CompoundTag({"blobs": [arrays(rng, index) for index in range(max(1, int(32 * scale)))]}),
+}
+
+
+def build(name: str, scale: float, seed: int = 20250101) -> CompoundTag:
+    return CORPORA[name](random.Random(f"{seed}:{name}"), scale)
@@ -0,0 +1,189 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+"""
+Benchmark harness: the load and dump of every case run in their own processes so peak RSS is not shared between them
+
+Usage:
+    python tests/bench/run.py [--scale 1.0] [--repeat 3] [--filter chunk] [--output results.json]
+    xmake run bench [same arguments]
+"""
+
+import os
+import sys
+import json
+import time
+import argparse
+import platform
+import subprocess
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from rapidnbt import nbtio, NbtFileFormat, NbtCompressionType, SnbtFormat
+from corpora import CORPORA, build
+
+
+def package_version() -> str:
+    try:
+        from importlib.metadata import version
+
+        return version("rapidnbt")
+    except Exception:
+        return "unknown"
+
+
+def peak_rss() -> int:
+    try:
+        import resource
+
+        usage = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        return usage if sys.platform == "darwin" else usage * 1024
+    except ImportError:
+        return 0
+
+
+def best_of(repeat: int, action) -> float:
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        action()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def encoder(codec: str):
+    if codec == "snbt":
+        return lambda tag: nbtio.dumps_snbt(tag, SnbtFormat.Minimize)
+    if codec == "json":
+        return lambda tag: tag.to_snbt(SnbtFormat.Jsonify)
+    format_name, compression_name = codec.split("+")
+    format = NbtFileFormat[format_name]
+    compression = NbtCompressionType[compression_name]
+    return lambda tag: nbtio.dumps(tag, format, compression)
+
+
+def decoder(codec: str):
+    if codec == "snbt":
+        return lambda encoded: nbtio.loads_snbt(encoded)
+    if codec == "json":
+        return lambda encoded: nbtio.loads_json(encoded)
+    format = NbtFileFormat[codec.split("+")[0]]
+    return lambda encoded: nbtio.loads(encoded, format)
+
+
+def run_case(phase: str, path: str, codec: str, repeat: int) -> dict:
+    """
+    Runs in the child process, one per phase so the peak RSS of a dump never hides the one of a load
+    For loads the file holds the encoded content, for dumps the uncompressed little-endian encoding of the corpus
+    The peak RSS never drops, so the baseline taken right before the measured phase is reported with it
+    """
+    with open(path, "rb") as file:
+        content = file.read()
+    if phase == "load":
+        content = content.decode() if codec in ("snbt", "json") else content
+        load = decoder(codec)
+        baseline = peak_rss()
+        seconds = best_of(repeat, lambda: load(content))
+    else:
+        tag = nbtio.loads(content, NbtFileFormat.LITTLE_ENDIAN)
+        del content
+        dump = encoder(codec)
+        baseline = peak_rss()
+        seconds = best_of(repeat, lambda: dump(tag))
+    return {"seconds": seconds, "baseline_rss_bytes": baseline, "peak_rss_bytes": peak_rss()}
+
+
+def run_child(phase: str, path: str, codec: str, repeat: int) -> dict:
+    output = subprocess.run(
+        [sys.executable, os.path.abspath(__file__), "--case", phase, path, codec, str(repeat)],
+        check=True,
+        capture_output=True,
+        text=True,
+    ).stdout
+    return json.loads(output)
+
+
+def codecs() -> list:
+    result = [f"{format.name}+{compression.name}" for format in NbtFileFormat for compression in NbtCompressionType]
+    return result + ["snbt", "json"]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="RapidNBT benchmark suite")
+    parser.add_argument("--scale", type=float, default=1.0, help="corpus size multiplier")
+    parser.add_argument("--repeat", type=int, default=3, help="runs per measurement, the best one is kept")
+    parser.add_argument("--filter", default="", help="only run cases whose name contains this text")
+    parser.add_argument("--output", default="", help="write JSON results to this file instead of stdout")
+    parser.add_argument("--case", nargs=4, metavar=("PHASE", "PATH", "CODEC", "REPEAT"), help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.case:
+        phase, path, codec, repeat = args.case
+        print(json.dumps(run_case(phase, path, codec, int(repeat))))
+        return
+
+    results = []
+    with tempfile.TemporaryDirectory() as folder:
+        for corpus in CORPORA:
+            tag = build(corpus, args.scale)
+            size = len(nbtio.dumps(tag, NbtFileFormat.LITTLE_ENDIAN, NbtCompressionType.NONE))
+            path = os.path.join(folder, f"{corpus}.nbt")
+            nbtio.dump(tag, path, NbtFileFormat.LITTLE_ENDIAN, NbtCompressionType.NONE)
+            for codec in codecs():
+                name = f"{corpus}/{codec}"
+                if args.filter not in name:
+                    continue
+                encoded = encoder(codec)(tag)
+                assert decoder(codec)(encoded) is not None
+                encoded_path = os.path.join(folder, f"{corpus}.{codec}")
+                with open(encoded_path, "wb") as file:
+                    file.write(encoded.encode() if isinstance(encoded, str) else encoded)
+                load = run_child("load", encoded_path, codec, args.repeat)
+                dump = run_child("dump", path, codec, args.repeat)
+                os.remove(encoded_path)
+                result = {
+                    "case": name,
+                    "corpus": corpus,
+                    "codec": codec,
+                    "payload_bytes": size,
+                    "encoded_bytes": len(encoded),
+                    "dump_seconds": dump["seconds"],
+                    "load_seconds": load["seconds"],
+                    "dump_mb_per_second": size / dump["seconds"] / 1e6,
+                    "load_mb_per_second": size / load["seconds"] / 1e6,
+                    "load_baseline_rss_bytes": load["baseline_rss_bytes"],
+                    "load_peak_rss_bytes": load["peak_rss_bytes"],
+                    "dump_baseline_rss_bytes": dump["baseline_rss_bytes"],
+                    "dump_peak_rss_bytes": dump["peak_rss_bytes"],
+                }
+                results.append(result)
+                print(
+                    f"{name:<48} load {result['load_mb_per_second']:8.1f} MB/s  dump {result['dump_mb_per_second']:8.1f} MB/s  "
+                    f"load peak {result['load_peak_rss_bytes'] / 2**20:7.0f} MB  dump peak {result['dump_peak_rss_bytes'] / 2**20:7.0f} MB",
+                    file=sys.stderr,
+                )
+            del tag
+
+    report = {
+        "version": package_version(),
+        "python": platform.python_version(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+        "scale": args.scale,
+        "repeat": args.repeat,
+        "results": results,
+    }
+    if args.output:
+        with open(args.output, "w") as file:
+            json.dump(report, file, indent=2)
+    else:
+        print(json.dumps(report, indent=2))
+
+
+if __name__ == "__main__":
+    main()
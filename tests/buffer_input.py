@@ -0,0 +1,36 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from array import array
+from rapidnbt import nbtio, CompoundTag, NbtFileFormat, NbtCompressionType
+
+
+def make_content() -> tuple:
+    # Grow a string until the encoding is a whole number of 4 byte items
+    for padding in range(4):
+        tag = CompoundTag({"Name": "x" * padding, "Pos": [1.0, 64.0, -1.0], "Count": 64})
+        content = nbtio.dumps(tag, NbtFileFormat.LITTLE_ENDIAN, NbtCompressionType.NONE)
+        if len(content) % 4 == 0:
+            return tag, content
+    raise AssertionError("no padding gives a multiple of 4 bytes")
+
+
+def main():
+    tag, content = make_content()
+    items = array("i")
+    items.frombytes(content)
+
+    # Buffers with items wider than one byte are read in full, not one byte per item
+    for source in (items, memoryview(content).cast("I")):
+        assert nbtio.loads(source, NbtFileFormat.LITTLE_ENDIAN) == tag
+        assert nbtio.loads(source) == tag
+        assert nbtio.detect_content_format(source) == NbtFileFormat.LITTLE_ENDIAN
+        assert CompoundTag.from_binary_nbt(source) == tag
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,23 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from rapidnbt import CompoundTag, NbtCompressionType, NbtFileFormat, nbtio
+
+
+def main():
+    # Larger than the 1 MiB format probe once inflated, so detection starts from an incomplete prefix
+    tag = CompoundTag({f"key_{index}": {"value": index, "name": f"entry {index}"} for index in range(60000)})
+    for format in (NbtFileFormat.LITTLE_ENDIAN, NbtFileFormat.BIG_ENDIAN, NbtFileFormat.BEDROCK_NETWORK):
+        for compression_type in (NbtCompressionType.NONE, NbtCompressionType.GZIP):
+            content = nbtio.dumps(tag, format, compression_type)
+            reader = nbtio.iter_events(content)
+            assert reader is not None and reader.format() == format, (format, compression_type)
+            assert sum(1 for _ in reader) > 0
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,53 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import time
+from rapidnbt import nbtio, ArrayFormat, CompoundTag, NbtCompressionType, NbtFileFormat
+
+
+def make_value(count: int) -> dict:
+    return {
+        f"entry_{index}": {
+            "id": f"minecraft:item_{index % 64}",
+            "Count": index % 64,
+            "Damage": index * 0.5,
+            "CanDestroy": True,
+            "Lore": ["first line", "second line"],
+            "Pos": (index, 64, -index),
+        }
+        for index in range(count)
+    }
+
+
+def main():
+    value = make_value(100000)
+
+    start = time.perf_counter()
+    expected = CompoundTag(value)
+    constructor = time.perf_counter() - start
+
+    start = time.perf_counter()
+    nbt = CompoundTag.from_python(value)
+    from_python = time.perf_counter() - start
+    assert nbt == expected
+
+    binary = nbtio.dumps(nbt, NbtFileFormat.LITTLE_ENDIAN, NbtCompressionType.NONE)
+    start = time.perf_counter()
+    assert nbtio.loads(binary, NbtFileFormat.LITTLE_ENDIAN) == nbt
+    parse = time.perf_counter() - start
+
+    typed = nbt.to_python(ArrayFormat.ARRAY, typed_numbers=True)
+    assert CompoundTag.from_python(typed) == nbt
+
+    print(f"entries: {len(value)}")
+    print(f"CompoundTag(dict): {constructor:.3f}s")
+    print(f"CompoundTag.from_python: {from_python:.3f}s")
+    print(f"nbtio.loads (binary): {parse:.3f}s")
+
+
+if __name__ == "__main__":
+    main()
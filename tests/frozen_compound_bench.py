@@ -0,0 +1,82 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+from rapidnbt import CompoundTag, FrozenCompoundTag, FrozenListTag, ShortTag, nbtio
+
+
+def make_block_states(count: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            f"minecraft:block_{index}": {
+                "version": 18090528,
+                "data": ShortTag(index % 16),
+                "hardness": index * 0.25,
+                "states": {"facing": ["north", "south", "east", "west"][index % 4], "open": index % 2},
+                "tags": [f"tag_{slot}" for slot in range(index % 3)],
+            }
+            for index in range(count)
+        }
+    )
+
+
+def lookup(table, count: int) -> int:
+    total = 0
+    for index in range(count):
+        total += table[f"minecraft:block_{index}"]["data"].get_short()
+    return total
+
+
+def main():
+    table = make_block_states(20000)
+    frozen = table.freeze()
+    assert isinstance(frozen, FrozenCompoundTag) and len(frozen) == 20000
+    assert frozen.materialize() == table
+    print(f"frozen document: {frozen.memory_usage() / 2**20:.1f} MiB")
+
+    # A key repeated in every element is stored once per document
+    repeated = CompoundTag({"palette": [{"minecraft:stone": index} for index in range(1000)]}).freeze()
+    distinct = CompoundTag({"palette": [{f"minecraft:{index:05}": index} for index in range(1000)]}).freeze()
+    assert distinct.memory_usage() - repeated.memory_usage() >= 999 * len("minecraft:stone")
+    print(f"1000 entries: repeated key {repeated.memory_usage()} bytes, distinct keys {distinct.memory_usage()} bytes")
+
+    for name, source in (("CompoundTag", table), ("FrozenCompoundTag", frozen)):
+        start = time.perf_counter()
+        expected = lookup(source, 20000)
+        print(f"{name} lookups: {time.perf_counter() - start:.3f}s")
+
+    block = frozen["minecraft:block_7"]
+    assert block.get_short("data") == 7 and block.get_double("hardness") == 1.75
+    assert block["states"].get_string("facing") == "west"
+    assert isinstance(block["tags"], FrozenListTag) and block["tags"][0].get_string() == "tag_0"
+    assert block.to_snbt() == table["minecraft:block_7"].to_snbt()
+    try:
+        block.get_int("data")
+    except TypeError as error:
+        print(error)
+    assert "missing" not in block
+
+    # Lookups from many threads share one document without locking
+    with ThreadPoolExecutor(8) as pool:
+        assert all(total == expected for total in pool.map(lambda _: lookup(frozen, 20000), range(8)))
+
+    with tempfile.TemporaryDirectory() as folder:
+        path = os.path.join(folder, "block_states.nbt")
+        assert nbtio.dump(table, path)
+        loaded = nbtio.load(path, frozen=True)
+        assert isinstance(loaded, FrozenCompoundTag) and loaded.materialize() == table
+        try:
+            nbtio.load(path, lazy=True, frozen=True)
+        except ValueError as error:
+            print(error)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,53 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import time
+from rapidnbt import nbtio, CompoundTag, LongArrayTag, InflateBackend, NbtFileFormat, NbtCompressionType
+
+
+def make_chunk(index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "xPos": index,
+            "zPos": -index,
+            "sections": [
+                {
+                    "Y": y,
+                    "BlockStates": LongArrayTag([(index + y * 7 + value) % 64 for value in range(256)]),
+                    "Palette": [{"Name": f"minecraft:block_{value}"} for value in range(8)],
+                }
+                for y in range(16)
+            ],
+        }
+    )
+
+
+def measure(contents: list, rounds: int) -> float:
+    start = time.perf_counter()
+    for _ in range(rounds):
+        for content in contents:
+            assert nbtio.loads(content, NbtFileFormat.BIG_ENDIAN) is not None
+    return time.perf_counter() - start
+
+
+def main():
+    chunks = [make_chunk(index) for index in range(64)]
+    backends = [backend for backend in InflateBackend if nbtio.is_inflate_backend_available(backend)]
+    default = nbtio.get_inflate_backend()
+    for compression_type in (NbtCompressionType.GZIP, NbtCompressionType.ZLIB):
+        contents = [nbtio.dumps(chunk, NbtFileFormat.BIG_ENDIAN, compression_type) for chunk in chunks]
+        baseline = None
+        for backend in backends:
+            nbtio.set_inflate_backend(backend)
+            elapsed = measure(contents, 20)
+            baseline = baseline or elapsed
+            print(f"{compression_type.name}, backend: {backend.name}, time: {elapsed:.3f}s, speedup: {baseline / elapsed:.2f}x")
+    nbtio.set_inflate_backend(default)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,62 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import threading
+from rapidnbt import CompoundTag, IntArrayTag, LongArrayTag, NbtFileFormat, nbtio
+
+
+def main():
+    source = CompoundTag(
+        {
+            "Heightmap": LongArrayTag(list(range(256))),
+            "Sections": [{"Y": y, "Blocks": bytes(16), "Light": IntArrayTag([y] * 4)} for y in range(4)],
+            "Biomes": [IntArrayTag([1, 2, 3]), IntArrayTag([4, 5, 6])],
+        }
+    )
+    for format in (NbtFileFormat.LITTLE_ENDIAN, NbtFileFormat.BIG_ENDIAN):
+        lazy = nbtio.loads(nbtio.dumps(source, format), format, lazy=True)
+        expected = source.copy()
+
+        # Array views are cached by their parent, so a write is seen by the next lookup instead of being dropped
+        lazy["Heightmap"][3] = -1
+        assert lazy["Heightmap"][3] == -1 and lazy["Heightmap"] is lazy["Heightmap"]
+        expected["Heightmap"].as_tag()[3] = -1
+        lazy["Sections"][2]["Light"][0] = 99
+        expected["Sections"][2]["Light"].as_tag()[0] = 99
+        lazy["Biomes"][1][2] = 60
+        expected["Biomes"][1].as_tag()[2] = 60
+        assert lazy["Sections"][2]["Light"][0] == 99 and lazy["Biomes"][1][2] == 60
+
+        # Materializing any level above a written array includes the write
+        assert lazy.materialize() == expected
+        assert lazy["Sections"].materialize() == expected["Sections"].as_tag()
+        assert lazy["Biomes"][1].materialize() == expected["Biomes"][1].as_tag()
+
+        # Materializing releases the GIL, writes and new views from another thread are either included or not, never torn
+        lazy = nbtio.loads(nbtio.dumps(source, format), format, lazy=True)
+        expected = source.copy()
+
+        def write():
+            for index in range(256):
+                lazy["Heightmap"][index] = -index
+                lazy["Sections"][index % 4]["Light"][index % 4] = index
+
+        writer = threading.Thread(target=write)
+        writer.start()
+        while writer.is_alive():
+            heightmap = lazy.materialize()["Heightmap"].as_tag()
+            assert len(heightmap) == 256 and all(value in (index, -index) for index, value in enumerate(heightmap))
+            lazy["Sections"].materialize()
+        writer.join()
+        for index in range(256):
+            expected["Heightmap"].as_tag()[index] = -index
+            expected["Sections"][index % 4]["Light"].as_tag()[index % 4] = index
+        assert lazy.materialize() == expected
+
+
+if __name__ == "__main__":
+    main()
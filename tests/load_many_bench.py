@@ -0,0 +1,64 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+import tempfile
+from rapidnbt import nbtio, CompoundTag, IntArrayTag, NbtFileFormat, NbtCompressionType
+
+
+def make_player(index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "Name": f"player_{index}",
+            "Pos": [float(index), 64.0, float(-index)],
+            "Inventory": [
+                {"Slot": slot, "id": f"minecraft:item_{slot}", "Count": 64}
+                for slot in range(36)
+            ],
+            "EnderItems": [
+                {"Slot": slot, "id": f"minecraft:item_{slot}", "Count": 1}
+                for slot in range(27)
+            ],
+            "UUID": IntArrayTag([index, 1, 2, 3]),
+        }
+    )
+
+
+def measure(paths: list, threads: int) -> float:
+    start = time.perf_counter()
+    results = nbtio.load_many(paths, threads=threads)
+    elapsed = time.perf_counter() - start
+    assert len(results) == len(paths) and all(result is not None for result in results)
+    return elapsed
+
+
+def main():
+    cpus = os.cpu_count() or 1
+    with tempfile.TemporaryDirectory() as folder:
+        paths = []
+        for index in range(4096):
+            path = os.path.join(folder, f"{index}.dat")
+            nbtio.dump(make_player(index), path, NbtFileFormat.BIG_ENDIAN, NbtCompressionType.GZIP)
+            paths.append(path)
+
+        for count in (256, 1024, 4096):
+            subset = paths[:count]
+            start = time.perf_counter()
+            for path in subset:
+                assert nbtio.load(path) is not None
+            serial = time.perf_counter() - start
+            print(f"files: {count}, nbtio.load loop: {serial:.3f}s")
+            threads = 1
+            while threads <= cpus:
+                elapsed = measure(subset, threads)
+                print(f"files: {count}, threads: {threads}, time: {elapsed:.3f}s, speedup: {serial / elapsed:.2f}x")
+                threads *= 2
+
+
+if __name__ == "__main__":
+    main()
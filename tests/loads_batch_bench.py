@@ -0,0 +1,55 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+from rapidnbt import nbtio, CompoundTag, NbtFileFormat, NbtCompressionType
+
+
+def make_block_entity(index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "id": "Chest",
+            "x": index % 16,
+            "y": index % 320 - 64,
+            "z": index // 16 % 16,
+            "isMovable": True,
+            "Items": [{"Slot": slot, "Name": "minecraft:stone", "Count": 1} for slot in range(index % 4)],
+        }
+    )
+
+
+def main():
+    cpus = os.cpu_count() or 1
+    values = [
+        nbtio.dumps(make_block_entity(index), NbtFileFormat.LITTLE_ENDIAN, NbtCompressionType.NONE)
+        for index in range(200000)
+    ]
+
+    start = time.perf_counter()
+    expected = [nbtio.loads(value, NbtFileFormat.LITTLE_ENDIAN) for value in values]
+    serial = time.perf_counter() - start
+    print(f"values: {len(values)}, nbtio.loads loop: {serial:.3f}s")
+
+    threads = 1
+    while threads <= cpus:
+        start = time.perf_counter()
+        results = nbtio.loads_batch(values, NbtFileFormat.LITTLE_ENDIAN, threads=threads)
+        elapsed = time.perf_counter() - start
+        assert results == expected
+        print(f"threads: {threads}, time: {elapsed:.3f}s, speedup: {serial / elapsed:.2f}x")
+        threads *= 2
+
+    # Buffers with multi-byte items are read in full, not one byte per item
+    padded = [value + bytes(-len(value) % 4) for value in values[:100]]
+    views = [memoryview(value).cast("I") for value in padded]
+    assert nbtio.loads_batch(views, NbtFileFormat.LITTLE_ENDIAN, strict_match_size=False) == expected[:100]
+    assert nbtio.loads_many(views, NbtFileFormat.LITTLE_ENDIAN, strict_match_size=False) == expected[:100]
+
+
+if __name__ == "__main__":
+    main()
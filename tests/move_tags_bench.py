@@ -0,0 +1,112 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import time
+from rapidnbt import CompoundTag, ListTag, LongArrayTag, TagType
+
+
+def make_region(count: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            f"chunk_{index}": {
+                "Heightmap": LongArrayTag(list(range(4096))),
+                "Sections": [{"Y": y, "Blocks": bytes(4096)} for y in range(16)],
+            }
+            for index in range(count)
+        }
+    )
+
+
+def main():
+    source = make_region(64)
+    expected = source.copy()
+
+    start = time.perf_counter()
+    copied = CompoundTag()
+    for key in source.keys():
+        copied.set(key, source[key].copy())
+        source.pop(key)
+    print(f"copy + pop: {time.perf_counter() - start:.3f}s")
+
+    source = expected.copy()
+    start = time.perf_counter()
+    moved = CompoundTag()
+    for key in source.keys():
+        moved.set(key, source.take(key), move=True)
+    print(f"take + set(move=True): {time.perf_counter() - start:.3f}s")
+    assert moved == expected == copied
+    assert len(source) == 0
+
+    # The moved-from tag stays usable, empty and of the same type
+    sections = moved["chunk_0"]["Sections"].as_tag().copy()
+    target = ListTag()
+    target.append(sections, move=True)
+    assert sections.size() == 0 and target[0].get_type() == TagType.List
+    assert isinstance(target.take(0), ListTag) and target.size() == 0
+
+    # A rejected append leaves the tag untouched
+    strings = ListTag(["a", "b"])
+    compound = CompoundTag({"x": 1})
+    try:
+        strings.append(compound, move=True)
+    except ValueError as error:
+        print(error)
+    assert compound == CompoundTag({"x": 1})
+
+    # Moving a tag into itself or one of its descendants is rejected and leaves the tree untouched
+    root = CompoundTag({"a": {"c": 1}, "l": [[[1]]]})
+    before = root.copy()
+    inner = root["a"].as_tag()
+    for insert in (
+        lambda: inner.set("b", root, move=True),
+        lambda: root.set("self", root, move=True),
+        lambda: root["l"][0].as_tag().append(root["l"], move=True),
+        lambda: root["l"][0].as_tag().append(root["l"][0], move=True),
+    ):
+        try:
+            insert()
+            raise AssertionError("moved a tag into its own subtree")
+        except ValueError as error:
+            print(error)
+        assert root == before
+    # Targets found with a path are checked the same way
+    for insert in (
+        lambda: root.query("l[0]").as_tag().append(root["l"], move=True),
+        lambda: root.query_all("l[][]")[0].as_tag().append(root["l"][0], check_type=False, move=True),
+    ):
+        try:
+            insert()
+            raise AssertionError("moved a tag into its own subtree")
+        except ValueError as error:
+            print(error)
+        assert root == before
+    # Moving from an unrelated branch of the same tree is still allowed
+    inner.set("b", root["l"][0][0], move=True)
+    assert root["a"]["b"].as_tag() == ListTag([1]) and root["l"][0][0].as_tag().size() == 0
+
+    # References obtained before take() follow the taken tag and outlive the tree it was taken from
+    tree = CompoundTag({"chunk": {"Sections": [{"Y": 1}, {"Y": 2}]}, "list": [[3], [4]]})
+    entry = tree["chunk"]
+    chunk = entry.as_tag()
+    section = entry["Sections"][1]
+    element = tree["list"][0]
+    element_list = element.as_tag()
+    taken = tree.take("chunk")
+    taken_element = tree["list"].as_tag().take(0)
+    del tree
+    assert entry.is_null() and element.is_null()
+    assert chunk["Sections"].size() == 2 and element_list.size() == 1
+    section["Y"] = 5
+    assert taken["Sections"][1]["Y"].get_int() == 5 and chunk["Sections"][1]["Y"].get_int() == 5
+    element_list.append(6)
+    assert taken_element == ListTag([3, 6])
+    del taken, taken_element
+    assert section["Y"].get_int() == 5 and chunk.size() == 1 and element_list.size() == 2
+
+
+if __name__ == "__main__":
+    main()
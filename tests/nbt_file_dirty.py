@@ -0,0 +1,45 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+import tempfile
+from rapidnbt import nbtio, CompoundTag, NbtCompressionType
+
+
+def main():
+    with tempfile.TemporaryDirectory() as folder:
+        paths = [os.path.join(folder, f"level_{index}.dat") for index in range(200)]
+        for index, path in enumerate(paths):
+            level = CompoundTag({"Data": {"LevelName": f"world {index}", "Seed": index, "Chunks": [{"x": x} for x in range(2000)]}})
+            nbtio.dump(level, path)
+        mtimes = [os.stat(path).st_mtime_ns for path in paths]
+
+        start = time.perf_counter()
+        for path in paths:
+            with nbtio.open(path) as file:
+                assert not file.is_modified()
+                assert file["Data"]["LevelName"].get_string().startswith("world")
+        print(f"read-only open: {len(paths)} files, {time.perf_counter() - start:.3f}s")
+        assert [os.stat(path).st_mtime_ns for path in paths] == mtimes
+
+        with nbtio.open(paths[0]) as file:
+            file["Data"]["Seed"] = 42
+            file["Extra"] = "value"
+            assert file.is_modified()
+            print(file.changed_keys())
+        assert nbtio.load(paths[0])["Data"]["Seed"].get_int() == 42
+
+        with nbtio.open(paths[1]) as file:
+            file.compression_type = NbtCompressionType.NONE
+            assert file.is_modified() and file.changed_keys() == []
+        with nbtio.open(paths[1]) as file:
+            assert file.compression_type == NbtCompressionType.NONE
+
+
+if __name__ == "__main__":
+    main()
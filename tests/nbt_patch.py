@@ -0,0 +1,88 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import time
+from rapidnbt import ByteTag, CompoundTag, LongArrayTag, NbtPatch, NbtPatchError, TagType
+
+
+def make_chunk(tick: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "xPos": 3,
+            "zPos": -7,
+            "LastUpdate": tick,
+            "Heightmap": LongArrayTag(list(range(4096))),
+            "Entities": [{"id": "minecraft:zombie", "Health": 20.0, "Pos": [float(index), 64.0, 0.0]} for index in range(64)],
+            "Sections": [{"Y": y, "Blocks": bytes(4096)} for y in range(16)],
+        }
+    )
+
+
+def main():
+    before = make_chunk(100)
+    after = before.copy()
+    after["LastUpdate"] = 101
+    after["Entities"][5]["Health"] = 12.5
+    after["Entities"].pop(10)
+    after["Heightmap"][2000] = 7
+    after["Structures"] = {"References": {}}
+    del after["zPos"]
+
+    patch = before.diff(after)
+    for op in patch.operations():
+        print(op[:2])
+    print(patch)
+    assert len(before.diff(before)) == 0
+
+    restored = before.copy()
+    restored.apply_patch(patch)
+    assert restored == after
+
+    data = patch.to_binary()
+    print(f"patch: {len(data)} bytes, full: {len(after.to_binary_nbt())} bytes")
+    again = before.copy()
+    again.apply_patch(NbtPatch.from_binary(data))
+    assert again == after
+
+    try:
+        CompoundTag({"xPos": 3}).apply_patch(patch)
+    except NbtPatchError as error:
+        print(error)
+
+    # Lists changing their element type, including from empty, keep a matching element type after the patch
+    for source, target in (([], [1, 2]), ([1, 2], []), ([1, 2], ["a"])):
+        tag = CompoundTag({"List": source})
+        tag.apply_patch(tag.diff(CompoundTag({"List": target})))
+        assert tag == CompoundTag({"List": target})
+        assert tag["List"].as_tag().get_element_type() == CompoundTag({"List": target})["List"].as_tag().get_element_type()
+    assert tag["List"].as_tag().get_element_type() == TagType.String
+    tag = CompoundTag({"List": [1, 2]})
+    tag.apply_patch(NbtPatch.from_tag(CompoundTag({"ops": [{"op": ByteTag(2), "path": "List", "value": ["x"], "offset": 0, "removed": 2}]})))
+    assert tag == CompoundTag({"List": ["x"]}) and tag["List"].as_tag().get_element_type() == TagType.String
+
+    # Edits that would mix element types in a list are rejected
+    for op in (
+        {"op": ByteTag(2), "path": "List", "value": ["x"], "offset": 1, "removed": 0},
+        {"op": ByteTag(0), "path": "List[0]", "value": "x"},
+    ):
+        mismatched = NbtPatch.from_tag(CompoundTag({"ops": [op]}))
+        tag = CompoundTag({"List": [1, 2]})
+        try:
+            tag.apply_patch(mismatched)
+            raise AssertionError("mismatched element type was applied")
+        except NbtPatchError as error:
+            print(error)
+        assert tag == CompoundTag({"List": [1, 2]})
+
+    start = time.perf_counter()
+    for _ in range(1000):
+        before.diff(after)
+    print(f"diff: {(time.perf_counter() - start) * 1000:.3f}us per call")
+
+
+if __name__ == "__main__":
+    main()
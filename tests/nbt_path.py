@@ -0,0 +1,38 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+from rapidnbt import ByteArrayTag, CompoundTag, IntArrayTag, NbtPath, NbtPathError
+
+
+def main():
+    nbt = CompoundTag.from_snbt(
+        '{Items:[{Slot:0b,id:"minecraft:stone"},{Slot:3b,id:"minecraft:dirt",tag:{display:{Name:"Dirt"}}}],'
+        'Level:{Sections:[{Y:0b},{Y:1b},{Y:2b},{Y:3b,BlockStates:[L;1L,2L]}]},"a b":1}'
+    )
+    nbt["UUID"] = IntArrayTag([1, 2, 3, 4])
+
+    print(nbt.query("Items[{Slot:3b}].tag.display.Name"))
+    print(nbt.query("Level.Sections[3].BlockStates"))
+    print(nbt.query_all("Items[].id"))
+    print(nbt.query("Level.Sections[-1].Y"), nbt.query('"a b"'), nbt.query("UUID[1]"))
+    assert nbt.query("Items[{Slot:5b}]") is None
+
+    # Byte array elements read the same 0-255 values as ByteArrayTag indexing
+    nbt["Bytes"] = ByteArrayTag(bytes([1, 200]))
+    assert nbt.query("Bytes[1]") == nbt["Bytes"].as_tag()[1] == 200
+    assert nbt.query_all("Bytes[]") == [1, 200]
+
+    path = NbtPath("Items[{Slot:0b}].id")
+    print(path, path.query_each([nbt, CompoundTag()]))
+    try:
+        NbtPath("Items[")
+    except NbtPathError as error:
+        print(error)
+
+
+if __name__ == "__main__":
+    main()
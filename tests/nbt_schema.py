@@ -0,0 +1,78 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import ctypes
+import time
+from rapidnbt import CompoundTag, IntArrayTag, NbtSchema, TagType, ShortTag
+
+SCHEMA = NbtSchema(
+    {
+        "Pos": "List[Double]",
+        "Motion": [TagType.Double],
+        "Health": TagType.Short,
+        "UUID": TagType.IntArray,
+        "LastSeen": TagType.Long,
+        "Attributes": [{"Base": TagType.Double}],
+    }
+)
+
+
+def entity(index: int) -> dict:
+    return {
+        "id": "minecraft:zombie",
+        "Pos": [index, 64.5, -index],
+        "Motion": (0.0, -0.08, 0.0),
+        "Health": 20,
+        "UUID": [index, -index, 7, 9],
+        "LastSeen": 1 << 40,
+        "Attributes": [{"Name": "generic.max_health", "Base": 20}],
+    }
+
+
+def entity_ctypes(index: int) -> dict:
+    return {
+        "id": "minecraft:zombie",
+        "Pos": [ctypes.c_double(index), ctypes.c_double(64.5), ctypes.c_double(-index)],
+        "Motion": [ctypes.c_double(0.0), ctypes.c_double(-0.08), ctypes.c_double(0.0)],
+        "Health": ctypes.c_int16(20),
+        "UUID": IntArrayTag([index, -index, 7, 9]),
+        "LastSeen": ctypes.c_int64(1 << 40),
+        "Attributes": [{"Name": "generic.max_health", "Base": ctypes.c_double(20)}],
+    }
+
+
+def main():
+    print(SCHEMA)
+    nbt = CompoundTag.from_python(entity(3), SCHEMA)
+    print(nbt.to_snbt())
+    assert nbt["Health"].get_type() == TagType.Short
+    assert nbt["UUID"].get_type() == TagType.IntArray
+    assert nbt["Pos"][0].get_type() == TagType.Double
+    assert CompoundTag.from_python({"Health": ShortTag(5)}, SCHEMA)["Health"].get_type() == TagType.Short
+    for spec in ({"Health": "Shrot"}, {"Pos": [TagType.Double, TagType.Float]}):
+        try:
+            NbtSchema(spec)
+        except ValueError as error:
+            print(error)
+    try:
+        CompoundTag.from_python({"Health": "20"}, SCHEMA)
+    except TypeError as error:
+        print(error)
+
+    values = [entity(index) for index in range(50000)]
+    wrapped = [entity_ctypes(index) for index in range(50000)]
+    start = time.perf_counter()
+    expected = [CompoundTag(value) for value in wrapped]
+    print(f"ctypes wrappers: {time.perf_counter() - start:.3f}s")
+    start = time.perf_counter()
+    typed = [CompoundTag.from_python(value, SCHEMA) for value in values]
+    print(f"schema: {time.perf_counter() - start:.3f}s")
+    assert typed == expected
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+from rapidnbt import nbtio, CompoundTag, LongArrayTag, NbtCompressionType, NbtCompressionLevel
+
+
+def make_world() -> CompoundTag:
+    return CompoundTag(
+        {
+            "sections": [
+                {
+                    "Y": index,
+                    "BlockStates": LongArrayTag([(index * 31 + value) % 4096 for value in range(4096)]),
+                    "Palette": [{"Name": f"minecraft:block_{value}"} for value in range(16)],
+                }
+                for index in range(512)
+            ]
+        }
+    )
+
+
+def main():
+    world = make_world()
+    cpus = os.cpu_count() or 1
+    for compression_type in (NbtCompressionType.GZIP, NbtCompressionType.ZLIB):
+        for level in (NbtCompressionLevel.DEFAULT, NbtCompressionLevel.BEST_COMPRESSION):
+            start = time.perf_counter()
+            baseline = nbtio.dumps(world, compression_type=compression_type, compression_level=level)
+            serial = time.perf_counter() - start
+            print(f"{compression_type.name} {level.name}, threads: 1, time: {serial:.3f}s, size: {len(baseline)}")
+            threads = 2
+            while threads <= cpus:
+                start = time.perf_counter()
+                content = nbtio.dumps(world, compression_type=compression_type, compression_level=level, compression_threads=threads)
+                elapsed = time.perf_counter() - start
+                assert nbtio.detect_content_compression_type(content) == compression_type
+                assert nbtio.loads(content) == world
+                print(f"{compression_type.name} {level.name}, threads: {threads}, time: {elapsed:.3f}s, speedup: {serial / elapsed:.2f}x, size: {len(content)}")
+                threads *= 2
+
+
+if __name__ == "__main__":
+    main()
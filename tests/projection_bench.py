@@ -0,0 +1,49 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+import tempfile
+from rapidnbt import nbtio, CompoundTag, LongArrayTag, NbtFileFormat, NbtCompressionType
+
+
+def make_level() -> CompoundTag:
+    return CompoundTag(
+        {
+            "Data": {
+                "LevelName": "World",
+                "Player": {"Name": "Steve", "Health": 20.0, "Pos": [0.5, 64.0, 0.5]},
+                "Chunks": [
+                    {"x": x, "z": z, "Heightmap": LongArrayTag(list(range(256)))}
+                    for x in range(32)
+                    for z in range(32)
+                ],
+            }
+        }
+    )
+
+
+def main():
+    with tempfile.TemporaryDirectory() as folder:
+        path = os.path.join(folder, "level.dat")
+        nbtio.dump(make_level(), path, NbtFileFormat.BIG_ENDIAN, NbtCompressionType.GZIP)
+        print(f"file: {os.path.getsize(path) / 1024:.0f} KiB")
+
+        include = ["Data.Player", "Data.LevelName"]
+        projected = nbtio.load(path, include=include)
+        full = nbtio.load(path)
+        assert projected == CompoundTag({"Data": {"LevelName": full["Data"]["LevelName"], "Player": full["Data"]["Player"]}})
+
+        for name, kwargs in (("full", {}), ("include", {"include": include})):
+            start = time.perf_counter()
+            for _ in range(20):
+                nbtio.load(path, **kwargs)
+            print(f"{name}: {(time.perf_counter() - start) / 20 * 1000:.2f} ms per load")
+
+
+if __name__ == "__main__":
+    main()
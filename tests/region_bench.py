@@ -0,0 +1,87 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+import random
+import tempfile
+import threading
+from rapidnbt import RegionFile, CompoundTag, ByteArrayTag, LongArrayTag, LongTag, NbtCompressionType
+
+
+def make_chunk(rng: random.Random, x: int, z: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "xPos": x,
+            "zPos": z,
+            "LastUpdate": LongTag(rng.getrandbits(40)),
+            "Status": "minecraft:full",
+            "sections": [
+                {
+                    "Y": y,
+                    "block_states": {
+                        "palette": [{"Name": f"minecraft:block_{rng.randrange(64)}"} for _ in range(8)],
+                        "data": LongArrayTag([rng.getrandbits(63) for _ in range(256)]),
+                    },
+                    "BlockLight": ByteArrayTag(bytes(rng.randrange(4) for _ in range(2048))),
+                }
+                for y in range(-4, 20)
+            ],
+        }
+    )
+
+
+def main():
+    cpus = os.cpu_count() or 1
+    rng = random.Random(20250101)
+    chunks = {(x, z): make_chunk(rng, x, z) for z in range(32) for x in range(32)}
+    with tempfile.TemporaryDirectory() as folder:
+        path = os.path.join(folder, "r.0.0.mca")
+        region = RegionFile()
+        start = time.perf_counter()
+        region.write_chunks(chunks, NbtCompressionType.ZLIB)
+        assert region.save(path)
+        print(f"write: {len(chunks)} chunks, {time.perf_counter() - start:.3f}s, {os.path.getsize(path) / 1048576:.1f} MiB")
+
+        region = RegionFile.open(path)
+        assert region is not None and len(region) == len(chunks)
+        assert region.read_chunk(5, 7) == chunks[(5, 7)]
+        assert region.read_chunks([(-27, 39)])[(-27, 39)] == chunks[(5, 7)]
+
+        threads = 1
+        while threads <= cpus:
+            start = time.perf_counter()
+            result = region.read_chunks(threads=threads)
+            elapsed = time.perf_counter() - start
+            assert all(tag is not None for tag in result.values())
+            rate = len(result) / elapsed
+            print(f"threads: {threads}, time: {elapsed:.3f}s, chunks/s: {rate:.0f}, chunks/s/core: {rate / threads:.0f}")
+            threads *= 2
+
+        region.remove_chunk(0, 0)
+        assert region.save(path)
+        assert RegionFile.open(path, file_memory_map=True).chunk_coords()[0] == (1, 0)
+
+        # Writes and saves over the mapped file may overlap reads from other threads, every chunk is read whole
+        region = RegionFile.open(path, file_memory_map=True)
+
+        def write():
+            for x in range(8):
+                region.write_chunk(x, 0, chunks[(x, 1)])
+                assert region.save(path)
+
+        writer = threading.Thread(target=write)
+        writer.start()
+        while writer.is_alive():
+            result = region.read_chunks([(x, 0) for x in range(1, 8)], threads=2)
+            assert all(result[(x, 0)] in (chunks[(x, 0)], chunks[(x, 1)]) for x in range(1, 8))
+        writer.join()
+        assert region.read_chunk(0, 0) == chunks[(0, 1)] and RegionFile.open(path).read_chunk(7, 0) == chunks[(7, 1)]
+
+
+if __name__ == "__main__":
+    main()
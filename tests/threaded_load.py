@@ -0,0 +1,58 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import os
+import time
+import tempfile
+from concurrent.futures import ThreadPoolExecutor
+from rapidnbt import nbtio, CompoundTag, IntArrayTag, LongArrayTag, NbtFileFormat
+
+
+def make_sample(index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "Name": f"player_{index}",
+            "Pos": [float(index), 64.0, float(-index)],
+            "Inventory": [
+                {"Slot": slot, "id": f"minecraft:item_{slot}", "Count": 64}
+                for slot in range(36)
+            ],
+            "Heightmap": IntArrayTag(list(range(256))),
+            "BlockStates": LongArrayTag(list(range(4096))),
+        }
+    )
+
+
+def run(paths: list, threads: int) -> float:
+    start = time.perf_counter()
+    with ThreadPoolExecutor(max_workers=threads) as executor:
+        results = list(executor.map(nbtio.load, paths))
+    elapsed = time.perf_counter() - start
+    assert all(result is not None for result in results)
+    return elapsed
+
+
+def main():
+    with tempfile.TemporaryDirectory() as folder:
+        paths = []
+        for index in range(256):
+            path = os.path.join(folder, f"{index}.dat")
+            nbtio.dump(make_sample(index), path, NbtFileFormat.BIG_ENDIAN)
+            paths.append(path)
+
+        baseline = run(paths, 1)
+        print(f"threads: 1, time: {baseline:.3f}s, speedup: 1.00x")
+        threads = 2
+        while threads <= (os.cpu_count() or 1):
+            elapsed = run(paths, threads)
+            speedup = baseline / elapsed
+            print(f"threads: {threads}, time: {elapsed:.3f}s, speedup: {speedup:.2f}x")
+            threads *= 2
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,72 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import array
+import ctypes
+import json
+import sys
+import time
+import tracemalloc
+from rapidnbt import ArrayFormat, CompoundTag, ByteArrayTag, IntArrayTag, LongTag, ShortTag
+
+
+def make_level(count: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "Name": "world",
+            "Seed": LongTag(-123456789),
+            "Entities": [
+                {
+                    "id": f"minecraft:entity_{index % 32}",
+                    "Pos": [index * 0.5, 64.0, -index * 0.25],
+                    "Health": ShortTag(20),
+                    "UUID": IntArrayTag([index, -index, index * 3, 7]),
+                    "Data": ByteArrayTag(bytes(range(16))),
+                    "Tags": [f"tag{slot}" for slot in range(index % 4)],
+                }
+                for index in range(count)
+            ],
+        }
+    )
+
+
+def main():
+    nbt = make_level(100000)
+
+    value = nbt.to_python()
+    assert value["Seed"] == -123456789 and value["Entities"][3]["Data"] == bytes(range(16))
+    assert value["Entities"][3]["UUID"] == array.array("i", [3, -3, 9, 7])
+    assert nbt.to_python(ArrayFormat.LIST)["Entities"][3]["UUID"] == [3, -3, 9, 7]
+    typed = nbt.to_python(typed_numbers=True)
+    assert isinstance(typed["Entities"][0]["Health"], ctypes.c_int16)
+    assert CompoundTag(typed)["Entities"][5] == nbt["Entities"][5]
+    assert nbt["Entities"].to_python(ArrayFormat.LIST)[1]["Tags"] == ["tag0"]
+
+    # Repeated keys share one str, across documents too when interned
+    first, second = list(value["Entities"][0]), list(value["Entities"][1])
+    assert all(a is b for a, b in zip(first, second))
+    interned = nbt["Entities"].to_python(intern_keys=True)
+    assert [key for key in interned[0] if key == "id"][0] is sys.intern("id")
+    tracemalloc.start()
+    value = nbt.to_python()
+    print(f"to_python() peak: {tracemalloc.get_traced_memory()[1] / 2**20:.1f} MiB")
+    tracemalloc.stop()
+    del value
+
+    for name, convert in (
+        ("json.loads(to_json())", lambda: json.loads(nbt.to_json())),
+        ("to_dict()", nbt.to_dict),
+        ("to_python()", nbt.to_python),
+        ("to_python(LIST)", lambda: nbt.to_python(ArrayFormat.LIST)),
+    ):
+        start = time.perf_counter()
+        convert()
+        print(f"{name}: {time.perf_counter() - start:.3f}s")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+# Copyright © 2025 GlacieTeam. All rights reserved.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# SPDX-License-Identifier: MPL-2.0
+
+import time
+from rapidnbt import CompoundTag, IntArrayTag
+
+
+def make_chunk(index: int) -> CompoundTag:
+    return CompoundTag(
+        {
+            "xPos": index,
+            "zPos": -index,
+            "Entities": [{"id": "minecraft:zombie", "Pos": [float(slot), 64.0, float(index)], "UUID": IntArrayTag([slot, index, 7, 9])} for slot in range(200)],
+            "Sections": [{"Y": y, "Blocks": bytes(4096)} for y in range(16)],
+        }
+    )
+
+
+def main():
+    chunks = [make_chunk(index % 50) for index in range(200)]
+
+    start = time.perf_counter()
+    first = [hash(chunk) for chunk in chunks]
+    print(f"first hash: {time.perf_counter() - start:.3f}s")
+    start = time.perf_counter()
+    for _ in range(10):
+        assert [hash(chunk) for chunk in chunks] == first
+    print(f"hash x10: {time.perf_counter() - start:.3f}s")
+
+    start = time.perf_counter()
+    unique = set(chunks)
+    print(f"dedupe {len(chunks)} -> {len(unique)}: {time.perf_counter() - start:.3f}s")
+    assert len(unique) == 50
+
+    start = time.perf_counter()
+    unequal = sum(1 for chunk in chunks if not chunk.equals(chunks[0]))
+    print(f"equals against one chunk ({unequal} unequal): {time.perf_counter() - start:.3f}s")
+
+    # Nothing is cached, every hash sees the current tree
+    chunk = chunks[1]
+    before = hash(chunk)
+    chunk["Entities"][3]["Pos"][0].value = 0.5
+    assert hash(chunk) != before
+    assert hash(chunk) == hash(chunk.copy())
+
+    target = chunks[2]
+    before = hash(target)
+    target.apply_patch(target.diff(chunks[3]))
+    assert hash(target) != before and hash(target) == hash(chunks[3]) and target == chunks[3]
+
+    # Writes through a buffer view are seen as well
+    chunk = chunks[4]
+    view = memoryview(chunk["Entities"][5]["UUID"].as_tag())
+    before = hash(chunk)
+    view[0] = 12345
+    assert hash(chunk) != before and hash(chunk) == hash(chunk.copy())
+    view.release()
+
+
+if __name__ == "__main__":
+    main()
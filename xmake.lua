@@ -5,7 +5,8 @@ add_repositories("groupmountain-repo https://github.com/GroupMountain/xmake-repo
 add_requires(
     "nbt 2.6.3",
     "pybind11-header 3.0.1",
-    "magic_enum 0.9.7"
+    "magic_enum 0.9.7",
+    "zlib"
 )
 
 if is_plat("windows") and not has_config("vs_runtime") then
@@ -22,6 +23,16 @@ option("pylinkdir")
     set_values({})
 option_end()
 
+option("libdeflate")
+    set_default(true)
+    set_showmenu(true)
+    set_description("Inflate compressed NBT with libdeflate")
+option_end()
+
+if has_config("libdeflate") then
+    add_requires("libdeflate")
+end
+
 target("_NBT")
     set_languages("c++23")
     set_kind("shared")
@@ -31,8 +42,13 @@ target("_NBT")
     add_packages(
         "pybind11-header",
         "nbt",
-        "magic_enum"
+        "magic_enum",
+        "zlib"
     )
+    if has_config("libdeflate") then
+        add_packages("libdeflate")
+        add_defines("RAPIDNBT_USE_LIBDEFLATE")
+    end
     add_includedirs("bindings")
     add_files("bindings/**.cpp")
     add_includedirs(get_config("pyincludedir"))
@@ -92,3 +108,18 @@ target("_NBT")
             )
         end
     end
+
+target("bench")
+    set_kind("phony")
+    set_default(false)
+    on_run(function (target)
+        import("core.base.option")
+        import("lib.detect.find_tool")
+        local python = find_tool("python3") or find_tool("python")
+        if not python then
+            raise("python not found")
+        end
+        local argv = {path.join(os.projectdir(), "tests", "bench", "run.py")}
+        table.join2(argv, option.get("arguments") or {})
+        os.execv(python.program, argv, {envs = {PYTHONPATH = os.projectdir()}})
+    end)